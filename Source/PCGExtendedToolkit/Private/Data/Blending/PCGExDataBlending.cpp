@@ -62,14 +62,19 @@ namespace PCGExDataBlending
 
 namespace PCGExDataBlendingTask
 {
-	bool FBlendCompoundedIO::ExecuteTask()
+	void BlendCompoundedIO(
+		PCGExData::FPointIO* SourceIO,
+		PCGExData::FPointIO* TargetIO,
+		FPCGExBlendingSettings* BlendingSettings,
+		PCGExData::FIdxCompoundList* CompoundList,
+		const FPCGExDistanceSettings& DistSettings)
 	{
-		PointIO->CreateInKeys();
+		SourceIO->CreateInKeys();
 
 		PCGExDataBlending::FMetadataBlender* MetadataBlender = new PCGExDataBlending::FMetadataBlender(BlendingSettings);
 		MetadataBlender->PrepareForData(*TargetIO);
 
-		const TArray<FPCGPoint>& SourcePoints = PointIO->GetIn()->GetPoints();
+		const TArray<FPCGPoint>& SourcePoints = SourceIO->GetIn()->GetPoints();
 
 		for (int i = 0; i < CompoundList->Compounds.Num(); i++)
 		{
@@ -83,7 +88,7 @@ namespace PCGExDataBlendingTask
 			for (int j = 0; j < Idx->CompoundedPoints.Num(); j++)
 			{
 				const uint32 SourceIndex = PCGEx::H64B(Idx->CompoundedPoints[j]);
-				MetadataBlender->Blend(Target, PointIO->GetInPointRef(SourceIndex), Target, Idx->Weights[j]);
+				MetadataBlender->Blend(Target, SourceIO->GetInPointRef(SourceIndex), Target, Idx->Weights[j]);
 			}
 
 			MetadataBlender->CompleteBlending(Target, Idx->CompoundedPoints.Num());
@@ -91,17 +96,12 @@ namespace PCGExDataBlendingTask
 
 		MetadataBlender->Write();
 		PCGEX_DELETE(MetadataBlender);
-
-		if (MetadataSettings)
-		{
-			// Write fuse meta after, so we don't blend it
-			Manager->Start<FWriteFuseMetadata>(TaskIndex, TargetIO, MetadataSettings, CompoundList);
-		}
-
-		return true;
 	}
 
-	bool FWriteFuseMetadata::ExecuteTask()
+	bool WriteFuseMetadata(
+		PCGExData::FPointIO* TargetIO,
+		const PCGExGraph::FGraphMetadataSettings* MetadataSettings,
+		const PCGExData::FIdxCompoundList* CompoundList)
 	{
 		const bool bWriteCompounded = MetadataSettings->bWriteCompounded;
 		const bool bWriteCompoundSize = MetadataSettings->bWriteCompoundSize;
@@ -111,8 +111,8 @@ namespace PCGExDataBlendingTask
 		PCGEx::TFAttributeWriter<bool>* CompoundedWriter = bWriteCompounded ? new PCGEx::TFAttributeWriter<bool>(MetadataSettings->CompoundedAttributeName, false, false) : nullptr;
 		PCGEx::TFAttributeWriter<int32>* CompoundSizeWriter = bWriteCompoundSize ? new PCGEx::TFAttributeWriter<int32>(MetadataSettings->CompoundSizeAttributeName, 0, false) : nullptr;
 
-		if (CompoundedWriter) { CompoundedWriter->BindAndGet(*PointIO); }
-		if (CompoundSizeWriter) { CompoundSizeWriter->BindAndGet(*PointIO); }
+		if (CompoundedWriter) { CompoundedWriter->BindAndGet(*TargetIO); }
+		if (CompoundSizeWriter) { CompoundSizeWriter->BindAndGet(*TargetIO); }
 
 		for (int i = 0; i < CompoundList->Compounds.Num(); i++)
 		{
@@ -129,4 +129,22 @@ namespace PCGExDataBlendingTask
 
 		return true;
 	}
+
+	bool FBlendCompoundedIO::ExecuteTask()
+	{
+		BlendCompoundedIO(PointIO, TargetIO, BlendingSettings, CompoundList, DistSettings);
+
+		if (MetadataSettings)
+		{
+			// Write fuse meta after, so we don't blend it
+			Manager->Start<FWriteFuseMetadata>(TaskIndex, TargetIO, MetadataSettings, CompoundList);
+		}
+
+		return true;
+	}
+
+	bool FWriteFuseMetadata::ExecuteTask()
+	{
+		return WriteFuseMetadata(PointIO, MetadataSettings, CompoundList);
+	}
 }
@@ -3,6 +3,66 @@
 
 #include "Data/PCGExData.h"
 
+#include "PCGExMT.h"
+
+void UPCGExPointIndexViewData::Initialize(const UPCGPointData* InSource, const TSharedPtr<const TArray<int32>>& InIndices, const int32 InStart, const int32 InCount)
+{
+	InitializeFromData(InSource);
+
+	Source = InSource;
+	Indices = InIndices;
+	Start = InStart;
+	Count = InCount;
+
+	const TArray<FPCGPoint>& SourcePoints = Source->GetPoints();
+	const TArray<int32>& SourceIndices = *Indices;
+
+	Bounds = FBox(ForceInit);
+	for (int i = Start; i < Start + Count; i++)
+	{
+		const FPCGPoint& Point = SourcePoints[SourceIndices[i]];
+		Bounds += Point.GetLocalBounds().TransformBy(Point.Transform);
+	}
+}
+
+bool UPCGExPointIndexViewData::SamplePoint(const FTransform& Transform, const FBox& InBounds, FPCGPoint& OutPoint, UPCGMetadata* OutMetadata) const
+{
+	const UPCGPointData* PointData = ToPointData(nullptr);
+	return PointData && PointData->SamplePoint(Transform, InBounds, OutPoint, OutMetadata);
+}
+
+const UPCGPointData* UPCGExPointIndexViewData::CreatePointData(FPCGContext* Context) const
+{
+	UPCGPointData* PointData = NewObject<UPCGPointData>();
+	PointData->InitializeFromData(this);
+
+	const TArray<FPCGPoint>& SourcePoints = Source->GetPoints();
+	const TArray<int32>& SourceIndices = *Indices;
+
+	TArray<FPCGPoint>& OutPoints = PointData->GetMutablePoints();
+	OutPoints.SetNumUninitialized(Count);
+
+	PCGExMT::ParallelFor(Count, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { OutPoints[i] = SourcePoints[SourceIndices[Start + i]]; });
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+	PointData->Metadata->Flatten();
+#endif
+
+	return PointData;
+}
+
+UPCGSpatialData* UPCGExPointIndexViewData::CopyInternal() const
+{
+	// Metadata is initialized by the caller
+	UPCGExPointIndexViewData* NewView = NewObject<UPCGExPointIndexViewData>();
+	NewView->Source = Source;
+	NewView->Indices = Indices;
+	NewView->Start = Start;
+	NewView->Count = Count;
+	NewView->Bounds = Bounds;
+	return NewView;
+}
+
 namespace PCGExData
 {
 #pragma region FIdxCompound
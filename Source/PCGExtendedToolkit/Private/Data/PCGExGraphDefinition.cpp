@@ -67,7 +67,8 @@ namespace PCGExGraph
 
 		if (LocalAngleGetter && LocalAngleGetter->IsUsable(PointIO.GetNum()) && Descriptor.bLocalAngleIsDegrees)
 		{
-			for (int i = 0; i < LocalAngleGetter->Values.Num(); i++) { LocalAngleGetter->Values[i] = PCGExMath::DegreesToDot(LocalAngleGetter->Values[i]); }
+			TArray<double>& AngleValues = LocalAngleGetter->GetMutableValues();
+			for (int i = 0; i < AngleValues.Num(); i++) { AngleValues[i] = PCGExMath::DegreesToDot(AngleValues[i]); }
 		}
 
 #undef PCGEX_LOCAL_SOCKET_ATT
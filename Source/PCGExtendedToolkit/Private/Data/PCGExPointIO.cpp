@@ -6,6 +6,10 @@
 #include "PCGExMT.h"
 #include "Metadata/Accessors/PCGAttributeAccessorKeys.h"
 
+DECLARE_STATS_GROUP(TEXT("PCGEx"), STATGROUP_PCGEx, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Attribute Column Cache Hits"), STAT_PCGExColumnCacheHits, STATGROUP_PCGEx);
+DECLARE_MEMORY_STAT(TEXT("Attribute Column Bytes Saved"), STAT_PCGExColumnBytesSaved, STATGROUP_PCGEx);
+
 namespace PCGExData
 {
 #pragma region FPointIO
@@ -186,12 +190,38 @@ namespace PCGExData
 		return OutData;
 	}
 
+	TSharedPtr<FColumn> FPointIO::FindColumn(const FString& Key) const
+	{
+		if (RootIO) { return RootIO->FindColumn(Key); }
+
+		FReadScopeLock ReadLock(ColumnsLock);
+		const TSharedPtr<FColumn>* Column = Columns.Find(Key);
+		if (!Column) { return nullptr; }
+
+		INC_DWORD_STAT(STAT_PCGExColumnCacheHits);
+		INC_MEMORY_STAT_BY(STAT_PCGExColumnBytesSaved, (*Column)->GetAllocatedSize());
+		return *Column;
+	}
+
+	TSharedPtr<FColumn> FPointIO::AddColumn(const FString& Key, const TSharedPtr<FColumn>& Column) const
+	{
+		if (RootIO) { return RootIO->AddColumn(Key, Column); }
+
+		FWriteScopeLock WriteLock(ColumnsLock);
+		if (const TSharedPtr<FColumn>* Existing = Columns.Find(Key)) { return *Existing; }
+		Columns.Add(Key, Column);
+		return Column;
+	}
+
 	void FPointIO::Cleanup()
 	{
 		if (!RootIO) { PCGEX_DELETE(InKeys) }
 		else { InKeys = nullptr; }
 
 		PCGEX_DELETE(OutKeys)
+
+		FWriteScopeLock WriteLock(ColumnsLock);
+		Columns.Empty();
 	}
 
 	FPointIO::~FPointIO()
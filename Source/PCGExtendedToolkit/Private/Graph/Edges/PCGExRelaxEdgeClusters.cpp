@@ -25,9 +25,7 @@ FPCGExRelaxEdgeClustersContext::~FPCGExRelaxEdgeClustersContext()
 
 	PCGEX_DELETE(InfluenceGetter)
 
-	OriginalBuffer.Empty();
-	PrimaryBuffer.Empty();
-	SecondaryBuffer.Empty();
+	RelaxedPositions.Empty();
 }
 
 bool FPCGExRelaxEdgeClustersElement::Boot(FPCGContext* InContext) const
@@ -37,6 +35,8 @@ bool FPCGExRelaxEdgeClustersElement::Boot(FPCGContext* InContext) const
 	PCGEX_CONTEXT_AND_SETTINGS(RelaxEdgeClusters)
 
 	Context->Iterations = FMath::Max(Settings->Iterations, 1);
+	Context->bUseLocalInfluence = Settings->InfluenceSettings.bUseLocalInfluence;
+	Context->bProgressiveInfluence = Settings->InfluenceSettings.bProgressiveInfluence;
 
 	PCGEX_OPERATION_BIND(Relaxing, UPCGExForceDirectedRelaxing)
 
@@ -61,14 +61,6 @@ bool FPCGExRelaxEdgeClustersElement::ExecuteInternal(FPCGContext* InContext) con
 
 	if (Context->IsState(PCGExMT::State_ReadyForNextPoints))
 	{
-		Context->CurrentIteration = 0;
-
-		if (Context->CurrentIO)
-		{
-			if (!Settings->InfluenceSettings.bProgressiveInfluence) { Context->Relaxing->ApplyInfluence(*Context->InfluenceGetter, &Context->OriginalBuffer); }
-			Context->Relaxing->WriteActiveBuffer(*Context->CurrentIO);
-		}
-
 		if (!Context->AdvancePointsIO()) { Context->Done(); }
 		else
 		{
@@ -88,61 +80,100 @@ bool FPCGExRelaxEdgeClustersElement::ExecuteInternal(FPCGContext* InContext) con
 
 				const TArray<FPCGPoint>& InPoints = Context->CurrentIO->GetIn()->GetPoints();
 				const int32 NumPoints = InPoints.Num();
-				Context->OriginalBuffer.SetNumUninitialized(NumPoints);
-				Context->PrimaryBuffer.SetNumUninitialized(NumPoints);
-				Context->SecondaryBuffer.SetNumUninitialized(NumPoints);
+				Context->RelaxedPositions.SetNumUninitialized(NumPoints);
+				for (int i = 0; i < NumPoints; i++) { Context->RelaxedPositions[i] = InPoints[i].Transform.GetLocation(); }
 
-				for (int i = 0; i < NumPoints; i++)
+				// Each cluster owns a disjoint set of points; relax them all concurrently, every iteration at once.
+				for (int i = 0; i < Context->TaggedEdges->Entries.Num(); i++)
 				{
-					Context->OriginalBuffer[i] = Context->PrimaryBuffer[i] = Context->SecondaryBuffer[i] = InPoints[i].Transform.GetLocation();
+					Context->GetAsyncManager()->Start<FPCGExRelaxClusterTask>(i, Context->CurrentIO, Context->TaggedEdges->Entries[i]);
 				}
 
-				Context->Relaxing->PrepareForPointIO(*Context->CurrentIO);
-
-				Context->SetState(PCGExGraph::State_ReadyForNextEdges);
+				Context->SetAsyncState(PCGExGraph::State_ProcessingEdges);
 			}
 		}
 	}
 
-	if (Context->IsState(PCGExGraph::State_ReadyForNextEdges))
+	if (Context->IsState(PCGExGraph::State_ProcessingEdges))
 	{
-		if (!Context->AdvanceEdges(true))
-		{
-			Context->SetState(PCGExMT::State_ReadyForNextPoints);
-			return false;
-		}
+		PCGEX_WAIT_ASYNC
 
-		Context->Relaxing->PrepareForCluster(*Context->CurrentEdges, Context->CurrentCluster);
-		Context->SetState(PCGExGraph::State_ProcessingEdges);
+		TArray<FPCGPoint>& MutablePoints = Context->CurrentIO->GetOut()->GetMutablePoints();
+		for (int i = 0; i < MutablePoints.Num(); i++) { MutablePoints[i].Transform.SetLocation(Context->RelaxedPositions[i]); }
+
+		Context->SetState(PCGExMT::State_ReadyForNextPoints);
 	}
 
-	if (Context->IsState(PCGExGraph::State_ProcessingEdges))
+	if (Context->IsDone()) { Context->OutputPointsAndEdges(); }
+
+	return Context->IsDone();
+}
+
+bool FPCGExRelaxClusterTask::ExecuteTask()
+{
+	FPCGExRelaxEdgeClustersContext* Context = Manager->GetContext<FPCGExRelaxEdgeClustersContext>();
+
+	EdgeIO->CreateInKeys();
+
+	PCGExCluster::FCluster* Cluster = PCGExCluster::GetOrBuildCluster(
+		*EdgeIO, PointIO->GetIn()->GetPoints(), Context->NodeIndicesMap, Context->EdgeNumReader->Values, Context->VtxTopologyCRC);
+
+	if (!Cluster)
 	{
-		auto Initialize = [&]()
-		{
-			Context->Relaxing->PrepareForIteration(Context->CurrentIteration, &Context->PrimaryBuffer, &Context->SecondaryBuffer);
-		};
+		// Bad cluster/edges.
+		EdgeIO->Cleanup();
+		return false;
+	}
 
-		auto ProcessNode = [&](const int32 NodeIndex)
-		{
-			const PCGExCluster::FNode& Vtx = Context->CurrentCluster->Nodes[NodeIndex];
-			Context->Relaxing->ProcessVertex(Vtx);
-		};
+	const UPCGExEdgeRelaxingOperation* Relaxing = Context->Relaxing;
+	const int32 NumNodes = Cluster->Nodes.Num();
+
+	TArray<FVector> OriginalBuffer;
+	TArray<FVector> PrimaryBuffer;
+	TArray<FVector> SecondaryBuffer;
+	TArray<double> Influences;
+
+	OriginalBuffer = Cluster->NodePositions;
+	Influences.SetNumUninitialized(NumNodes);
 
-		while (Context->CurrentIteration != Context->Iterations)
+	for (const PCGExCluster::FNode& Node : Cluster->Nodes) { Influences[Node.NodeIndex] = Context->InfluenceGetter->SafeGet(Node.PointIndex, Relaxing->DefaultInfluence); }
+
+	PrimaryBuffer = OriginalBuffer;
+	SecondaryBuffer = OriginalBuffer;
+
+	TArray<FVector>* ReadBuffer = &PrimaryBuffer;
+	TArray<FVector>* WriteBuffer = &SecondaryBuffer;
+
+	for (int Iteration = 0; Iteration < Context->Iterations; Iteration++)
+	{
+		if (!Checkpoint())
 		{
-			if (!Context->ProcessCurrentCluster(Initialize, ProcessNode)) { return false; }
-			Context->CurrentIteration++;
-			if (Settings->InfluenceSettings.bProgressiveInfluence) { Context->Relaxing->ApplyInfluence(*Context->InfluenceGetter); }
+			PCGEX_DELETE(Cluster)
 			return false;
 		}
 
-		Context->SetState(PCGExGraph::State_ReadyForNextEdges);
+		for (const PCGExCluster::FNode& Node : Cluster->Nodes) { (*WriteBuffer)[Node.NodeIndex] = Relaxing->ProcessNode(*Cluster, Node, *ReadBuffer); }
+
+		if (Context->bProgressiveInfluence)
+		{
+			for (int i = 0; i < NumNodes; i++) { (*WriteBuffer)[i] = FMath::Lerp((*ReadBuffer)[i], (*WriteBuffer)[i], Influences[i]); }
+		}
+
+		Swap(ReadBuffer, WriteBuffer);
 	}
 
-	if (Context->IsDone()) { Context->OutputPointsAndEdges(); }
+	// ReadBuffer holds the last iteration result
+	if (!Context->bProgressiveInfluence)
+	{
+		for (int i = 0; i < NumNodes; i++) { (*ReadBuffer)[i] = FMath::Lerp(OriginalBuffer[i], (*ReadBuffer)[i], Influences[i]); }
+	}
 
-	return Context->IsDone();
+	for (const PCGExCluster::FNode& Node : Cluster->Nodes) { Context->RelaxedPositions[Node.PointIndex] = (*ReadBuffer)[Node.NodeIndex]; }
+
+	PCGEX_DELETE(Cluster)
+	EdgeIO->Cleanup();
+
+	return true;
 }
 
 #undef LOCTEXT_NAMESPACE
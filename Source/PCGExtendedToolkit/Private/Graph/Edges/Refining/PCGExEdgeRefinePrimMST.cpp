@@ -52,12 +52,13 @@ void UPCGExEdgeRefinePrimMST::Process(PCGExCluster::FCluster* InCluster, PCGExGr
 		const PCGExCluster::FNode& Current = InCluster->Nodes[CurrentNodeIndex];
 		Visited.Add(CurrentNodeIndex);
 
-		for (const int32 AdjacentIndex : Current.AdjacentNodes)
+		for (int i = 0; i < Current.AdjacentNodes.Num(); i++)
 		{
+			const int32 AdjacentIndex = Current.AdjacentNodes[i];
 			if (Visited.Contains(AdjacentIndex)) { continue; } // Exit early
 
 			const PCGExCluster::FNode& AdjacentNode = InCluster->Nodes[AdjacentIndex];
-			const PCGExGraph::FIndexedEdge& Edge = InCluster->GetEdgeFromNodeIndices(CurrentNodeIndex, AdjacentIndex);
+			const PCGExGraph::FIndexedEdge& Edge = InCluster->Edges[Current.Edges[i]];
 
 			double Score = HeuristicsOperation->GetEdgeScore(Current, AdjacentNode, Edge, *NoNode, *NoNode);
 			Score += HeuristicsModifiers.GetScore(AdjacentNode.PointIndex, Edge.PointIndex);
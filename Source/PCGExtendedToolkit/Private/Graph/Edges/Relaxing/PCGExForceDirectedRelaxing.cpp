@@ -6,20 +6,19 @@
 
 #include "Graph/PCGExCluster.h"
 
-void UPCGExForceDirectedRelaxing::ProcessVertex(const PCGExCluster::FNode& Vertex)
+FVector UPCGExForceDirectedRelaxing::ProcessNode(const PCGExCluster::FCluster& Cluster, const PCGExCluster::FNode& Node, const TArray<FVector>& ReadBuffer) const
 {
-	const FVector Position = (*ReadBuffer)[Vertex.PointIndex];
+	const FVector Position = ReadBuffer[Node.NodeIndex];
 	FVector Force = FVector::Zero();
 
-	for (const int32 VtxIndex : Vertex.AdjacentNodes)
+	for (const int32 OtherNodeIndex : Node.AdjacentNodes)
 	{
-		const PCGExCluster::FNode& OtherVtx = CurrentCluster->Nodes[VtxIndex];
-		const FVector OtherPosition = (*ReadBuffer)[OtherVtx.PointIndex];
+		const FVector OtherPosition = ReadBuffer[OtherNodeIndex];
 		CalculateAttractiveForce(Force, Position, OtherPosition);
 		CalculateRepulsiveForce(Force, Position, OtherPosition);
 	}
 
-	(*WriteBuffer)[Vertex.PointIndex] = Position + Force;
+	return Position + Force;
 }
 
 void UPCGExForceDirectedRelaxing::CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const
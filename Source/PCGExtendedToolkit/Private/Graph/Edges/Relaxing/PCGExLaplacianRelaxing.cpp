@@ -6,16 +6,13 @@
 
 #include "Graph/PCGExCluster.h"
 
-void UPCGExLaplacianRelaxing::ProcessVertex(const PCGExCluster::FNode& Vertex)
+FVector UPCGExLaplacianRelaxing::ProcessNode(const PCGExCluster::FCluster& Cluster, const PCGExCluster::FNode& Node, const TArray<FVector>& ReadBuffer) const
 {
-	const FVector Position = (*ReadBuffer)[Vertex.PointIndex];
-	FVector Force = FVector::Zero();
+	const FVector Position = ReadBuffer[Node.NodeIndex];
+	if (Node.AdjacentNodes.IsEmpty()) { return Position; }
 
-	for (const int32 VtxIndex : Vertex.AdjacentNodes)
-	{
-		const PCGExCluster::FNode& OtherVtx = CurrentCluster->Nodes[VtxIndex];
-		Force += (*ReadBuffer)[OtherVtx.PointIndex] - (*ReadBuffer)[Vertex.PointIndex];
-	}
+	FVector Force = FVector::Zero();
+	for (const int32 OtherNodeIndex : Node.AdjacentNodes) { Force += ReadBuffer[OtherNodeIndex] - Position; }
 
-	(*WriteBuffer)[Vertex.PointIndex] = Position + Force / static_cast<double>(Vertex.AdjacentNodes.Num());
+	return Position + Force / static_cast<double>(Node.AdjacentNodes.Num());
 }
@@ -5,6 +5,7 @@
 
 #include "Elements/Metadata/PCGMetadataElementCommon.h"
 #include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoHull.h"
 #include "Graph/PCGExCluster.h"
 
 #define LOCTEXT_NAMESPACE "PCGExGraph"
@@ -136,51 +137,39 @@ bool FPCGExConvexHull3Task::ExecuteTask()
 	FPCGExBuildConvexHullContext* Context = static_cast<FPCGExBuildConvexHullContext*>(Manager->Context);
 	PCGEX_SETTINGS(BuildConvexHull)
 
-	PCGExGeo::TDelaunay3* Delaunay = new PCGExGeo::TDelaunay3();
-
-	const TArray<FPCGPoint>& Points = PointIO->GetIn()->GetPoints();
-	const int32 NumPoints = Points.Num();
-
 	TArray<FVector> Positions;
-	Positions.SetNumUninitialized(NumPoints);
-	for (int i = 0; i < NumPoints; i++) { Positions[i] = Points[i].Transform.GetLocation(); }
+	PCGExGeo::PointsToPositions(PointIO->GetIn()->GetPoints(), Positions);
 
 	const TArrayView<FVector> View = MakeArrayView(Positions);
-	if (!Delaunay->Process(View, true))
-	{
-		PCGEX_DELETE(Delaunay)
-		return false;
-	}
 
-	if (Settings->bPrunePoints)
+	if (!Settings->bPrunePoints)
 	{
-		PCGExGraph::FIndexedEdge E = PCGExGraph::FIndexedEdge{};
-		for (const uint64 Edge : Delaunay->DelaunayEdges)
+		// Full triangulation, with the hull optionally marked
+		PCGExGeo::TDelaunay3* Delaunay = new PCGExGeo::TDelaunay3();
+		if (!Delaunay->Process(View, true))
 		{
-			uint32 A;
-			uint32 B;
-			PCGEx::H64(Edge, A, B);
-			const bool bAIsOnHull = Delaunay->DelaunayHull.Contains(A);
-			const bool bBIsOnHull = Delaunay->DelaunayHull.Contains(B);
+			PCGEX_DELETE(Delaunay)
+			return false;
+		}
 
-			if (!bAIsOnHull || !bBIsOnHull)
-			{
-				if (!bAIsOnHull) { Context->GraphBuilder->Graph->Nodes[A].bValid = false; }
-				if (!bBIsOnHull) { Context->GraphBuilder->Graph->Nodes[B].bValid = false; }
-				continue;
-			}
+		if (Settings->bMarkHull) { Context->HullIndices.Append(Delaunay->DelaunayHull); }
+		Graph->InsertEdges(Delaunay->DelaunayEdges, -1);
 
-			Graph->InsertEdge(A, B, E);
-		}
+		PCGEX_DELETE(Delaunay)
+		return true;
 	}
-	else
+
+	PCGExGeo::TConvexHull3* ConvexHull = new PCGExGeo::TConvexHull3();
+	if (!ConvexHull->Process(View))
 	{
-		if (Settings->bMarkHull) { Context->HullIndices.Append(Delaunay->DelaunayHull); }
-		Graph->InsertEdges(Delaunay->DelaunayEdges, -1);
+		PCGEX_DELETE(ConvexHull)
+		return false;
 	}
 
+	// Points off the hull are left isolated, and pruned by the graph builder
+	Graph->InsertEdges(ConvexHull->HullEdges, -1);
 
-	PCGEX_DELETE(Delaunay)
+	PCGEX_DELETE(ConvexHull)
 	return true;
 }
 
@@ -5,6 +5,7 @@
 
 #include "Elements/Metadata/PCGMetadataElementCommon.h"
 #include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoHull.h"
 #include "Graph/PCGExCluster.h"
 
 #define LOCTEXT_NAMESPACE "PCGExGraph"
@@ -203,38 +204,38 @@ bool FPCGExConvexHull2Task::ExecuteTask()
 	FPCGExBuildConvexHull2DContext* Context = static_cast<FPCGExBuildConvexHull2DContext*>(Manager->Context);
 	PCGEX_SETTINGS(BuildConvexHull2D)
 
-	PCGExGeo::TDelaunay2* Delaunay = new PCGExGeo::TDelaunay2();
-
 	TArray<FVector> Positions;
 	PCGExGeo::PointsToPositions(Context->CurrentIO->GetIn()->GetPoints(), Positions);
 
 	const TArrayView<FVector> View = MakeArrayView(Positions);
-	if (!Delaunay->Process(View, Context->ProjectionSettings))
-	{
-		PCGEX_DELETE(Delaunay)
-		return false;
-	}
 
 	if (!Settings->bPrunePoints)
 	{
+		// Full triangulation, with the hull optionally marked
+		PCGExGeo::TDelaunay2* Delaunay = new PCGExGeo::TDelaunay2();
+		if (!Delaunay->Process(View, Context->ProjectionSettings))
+		{
+			PCGEX_DELETE(Delaunay)
+			return false;
+		}
+
 		if (Settings->bMarkHull) { Context->HullIndices.Append(Delaunay->DelaunayHull); }
 		Graph->InsertEdges(Delaunay->DelaunayEdges, -1);
-	}
 
-	PCGExGraph::FIndexedEdge E = PCGExGraph::FIndexedEdge{};
+		PCGEX_DELETE(Delaunay)
+		return true;
+	}
 
-	for (const uint64 Edge : Delaunay->DelaunayEdges)
+	PCGExGeo::TConvexHull2* ConvexHull = new PCGExGeo::TConvexHull2();
+	if (!ConvexHull->Process(View, Context->ProjectionSettings))
 	{
-		uint32 A;
-		uint32 B;
-		PCGEx::H64(Edge, A, B);
-		if (!Delaunay->DelaunayHull.Contains(A) ||
-			!Delaunay->DelaunayHull.Contains(B)) { continue; }
-		Graph->InsertEdge(A, B, E);
+		PCGEX_DELETE(ConvexHull)
+		return false;
 	}
 
+	Graph->InsertEdges(ConvexHull->HullEdges, -1);
 
-	PCGEX_DELETE(Delaunay)
+	PCGEX_DELETE(ConvexHull)
 	return true;
 }
 
@@ -24,18 +24,6 @@ namespace PCGExCluster
 {
 #pragma region FNode
 
-	FNode::~FNode()
-	{
-		AdjacentNodes.Empty();
-		Edges.Empty();
-	}
-
-	void FNode::AddConnection(const int32 InEdgeIndex, const int32 InNodeIndex)
-	{
-		Edges.AddUnique(InEdgeIndex);
-		AdjacentNodes.AddUnique(InNodeIndex);
-	}
-
 	FVector FNode::GetCentroid(FCluster* InCluster) const
 	{
 		if (AdjacentNodes.IsEmpty()) { return Position; }
@@ -66,33 +54,58 @@ namespace PCGExCluster
 
 #pragma region FCluster
 
+	int64 FClusterTopology::GetAllocatedSize() const
+	{
+		return sizeof(FClusterTopology)
+			+ PointIndexMap.GetAllocatedSize()
+			+ AdjacencyOffsets.GetAllocatedSize()
+			+ AdjacentNodeIndices.GetAllocatedSize()
+			+ AdjacentEdgeIndices.GetAllocatedSize();
+	}
+
 	FCluster::FCluster()
+		: Topology(MakeShared<FClusterTopology>())
 	{
-		PointIndexMap.Empty();
 		Nodes.Empty();
 		Edges.Empty();
 		Bounds = FBox(ForceInit);
 	}
 
+	FCluster::FCluster(const FCluster& Other)
+		: bEdgeLengthsDirty(Other.bEdgeLengthsDirty),
+		  bValid(Other.bValid),
+		  ClusterID(Other.ClusterID),
+		  Nodes(Other.Nodes), // Node views point into the shared topology & remain valid
+		  Edges(Other.Edges),
+		  EdgeLengths(Other.EdgeLengths),
+		  Bounds(Other.Bounds),
+		  Topology(Other.Topology),
+		  NodePositions(Other.NodePositions),
+		  PointsIO(Other.PointsIO),
+		  EdgesIO(Other.EdgesIO)
+	{
+	}
+
 	FCluster::~FCluster()
 	{
 		Nodes.Empty();
-		PointIndexMap.Empty();
 		Edges.Empty();
 		EdgeLengths.Empty();
+		NodePositions.Empty();
+		Topology.Reset();
 
 		PCGEX_DELETE(NodeOctree)
 		PCGEX_DELETE(EdgeOctree)
 	}
 
-	FNode& FCluster::GetOrCreateNode(const int32 PointIndex, const TArray<FPCGPoint>& InPoints)
+	FNode& FCluster::GetOrCreateNode(FClusterTopology& InTopology, const int32 PointIndex, const TArray<FPCGPoint>& InPoints)
 	{
-		if (const int32* NodeIndex = PointIndexMap.Find(PointIndex)) { return Nodes[*NodeIndex]; }
+		if (const int32* NodeIndex = InTopology.PointIndexMap.Find(PointIndex)) { return Nodes[*NodeIndex]; }
 
 		FNode& Node = Nodes.Emplace_GetRef();
 		const int32 NodeIndex = Nodes.Num() - 1;
 
-		PointIndexMap.Add(PointIndex, NodeIndex);
+		InTopology.PointIndexMap.Add(PointIndex, NodeIndex);
 
 		Node.PointIndex = PointIndex;
 		Node.NodeIndex = NodeIndex;
@@ -113,8 +126,9 @@ namespace PCGExCluster
 
 		Nodes.Empty();
 		Edges.Empty();
-		PointIndexMap.Empty();
-		EdgeIndexMap.Empty();
+
+		const TSharedPtr<FClusterTopology> NewTopology = MakeShared<FClusterTopology>();
+		Topology = NewTopology;
 
 		TArray<PCGExGraph::FIndexedEdge> EdgeList;
 		if (!BuildIndexedEdges(EdgeIO, InNodeIndicesMap, EdgeList, true))
@@ -127,11 +141,13 @@ namespace PCGExCluster
 
 		const int32 NumNodes = InNodePoints.Num();
 		Nodes.Reserve(NumNodes);
-		PointIndexMap.Reserve(NumNodes);
+		NewTopology->PointIndexMap.Reserve(NumNodes);
 
 		const int32 NumEdges = EdgeList.Num();
 		Edges.SetNumUninitialized(NumEdges);
-		EdgeIndexMap.Reserve(NumEdges);
+
+		TArray<FIntVector> Connections;
+		Connections.SetNumUninitialized(NumEdges);
 
 		//We need to sort edges in order to have deterministic processing of the clusters
 		EdgeList.Sort(
@@ -145,16 +161,15 @@ namespace PCGExCluster
 			PCGExGraph::FIndexedEdge& SortedEdge = (Edges[i] = EdgeList[i]);
 			SortedEdge.EdgeIndex = i;
 
-			FNode& Start = GetOrCreateNode(SortedEdge.Start, InNodePoints);
-			FNode& End = GetOrCreateNode(SortedEdge.End, InNodePoints);
-			EdgeIndexMap.Add(PCGEx::H64U(Start.NodeIndex, End.NodeIndex), i);
-
-			Start.AddConnection(i, End.NodeIndex);
-			End.AddConnection(i, Start.NodeIndex);
+			const int32 StartNodeIndex = GetOrCreateNode(*NewTopology, SortedEdge.Start, InNodePoints).NodeIndex;
+			const int32 EndNodeIndex = GetOrCreateNode(*NewTopology, SortedEdge.End, InNodePoints).NodeIndex;
+			Connections[i] = FIntVector(StartNodeIndex, EndNodeIndex, i);
 		}
 
 		EdgeList.Empty();
 
+		CompileAdjacency(*NewTopology, Connections);
+
 		for (FNode& Node : Nodes)
 		{
 			if (PerNodeEdgeNums[Node.PointIndex] > Node.AdjacentNodes.Num()) // We care about removed connections, not new ones 
@@ -168,37 +183,80 @@ namespace PCGExCluster
 		return bValid;
 	}
 
-	void FCluster::BuildPartialFrom(const TArray<FVector>& Positions, const TSet<uint64>& InEdges)
+	void FCluster::RefreshPositions(const TArray<FPCGPoint>& InNodePoints)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildCluster);
+		bool bMoved = false;
+		Bounds = FBox(ForceInit);
 
-		const int32 NumNodes = Positions.Num();
-		Nodes.SetNum(NumNodes);
+		for (FNode& Node : Nodes)
+		{
+			const FVector Position = InNodePoints[Node.PointIndex].Transform.GetLocation();
+			if (Position != Node.Position)
+			{
+				Node.Position = NodePositions[Node.NodeIndex] = Position;
+				bMoved = true;
+			}
+			Bounds += Position;
+		}
 
-		const int32 NumEdges = InEdges.Num();
-		Edges.SetNumUninitialized(NumEdges);
+		if (bMoved) { bEdgeLengthsDirty = true; }
+	}
 
-		for (int i = 0; i < NumNodes; i++)
-		{
-			FNode& Node = Nodes[i];
+	int64 FCluster::GetAllocatedSize() const
+	{
+		return sizeof(FCluster)
+			+ Topology->GetAllocatedSize()
+			+ Nodes.GetAllocatedSize()
+			+ Edges.GetAllocatedSize()
+			+ EdgeLengths.GetAllocatedSize()
+			+ NodePositions.GetAllocatedSize();
+	}
+
+	void FCluster::CompileAdjacency(FClusterTopology& InTopology, const TArray<FIntVector>& Connections)
+	{
+		const int32 NumNodes = Nodes.Num();
+
+		TArray<int32>& AdjacencyOffsets = InTopology.AdjacencyOffsets;
+		TArray<int32>& AdjacentNodeIndices = InTopology.AdjacentNodeIndices;
+		TArray<int32>& AdjacentEdgeIndices = InTopology.AdjacentEdgeIndices;
 
-			Node.PointIndex = i;
-			Node.NodeIndex = i;
-			Node.Position = Positions[i];
+		// Count degrees, then prefix-sum into row offsets
+		AdjacencyOffsets.SetNumZeroed(NumNodes + 1);
+		for (const FIntVector& Connection : Connections)
+		{
+			AdjacencyOffsets[Connection.X + 1]++;
+			AdjacencyOffsets[Connection.Y + 1]++;
 		}
 
-		int32 EdgeIndex = 0;
-		for (const uint64 Edge : InEdges)
+		for (int i = 0; i < NumNodes; i++) { AdjacencyOffsets[i + 1] += AdjacencyOffsets[i]; }
+
+		const int32 NumEntries = AdjacencyOffsets[NumNodes];
+		AdjacentNodeIndices.SetNumUninitialized(NumEntries);
+		AdjacentEdgeIndices.SetNumUninitialized(NumEntries);
+
+		TArray<int32> RowEnds;
+		RowEnds.SetNumUninitialized(NumNodes);
+		FMemory::Memcpy(RowEnds.GetData(), AdjacencyOffsets.GetData(), NumNodes * sizeof(int32));
+
+		auto AddConnection = [&](const int32 NodeIndex, const int32 OtherNodeIndex, const int32 EdgeIndex)
 		{
-			uint32 A;
-			uint32 B;
-			PCGEx::H64(Edge, A, B);
-			FNode& Start = Nodes[A];
-			FNode& End = Nodes[B];
+			const int32 Slot = RowEnds[NodeIndex]++;
+			AdjacentNodeIndices[Slot] = OtherNodeIndex;
+			AdjacentEdgeIndices[Slot] = EdgeIndex;
+		};
 
-			Start.AddConnection(-1, End.NodeIndex);
-			End.AddConnection(-1, Start.NodeIndex);
-			EdgeIndex++;
+		for (const FIntVector& Connection : Connections)
+		{
+			AddConnection(Connection.X, Connection.Y, Connection.Z);
+			AddConnection(Connection.Y, Connection.X, Connection.Z);
+		}
+
+		NodePositions.SetNumUninitialized(NumNodes);
+		for (FNode& Node : Nodes)
+		{
+			Node.AdjacentNodes = GetNeighbors(Node.NodeIndex);
+			Node.Edges = GetNeighborEdges(Node.NodeIndex);
+			NodePositions[Node.NodeIndex] = Node.Position;
 		}
 	}
 
@@ -218,8 +276,8 @@ namespace PCGExCluster
 		EdgeOctree = new ClusterItemOctree(Bounds.GetCenter(), Bounds.GetExtent().Length());
 		for (const PCGExGraph::FIndexedEdge& Edge : Edges)
 		{
-			const FNode& Start = Nodes[*PointIndexMap.Find(Edge.Start)];
-			const FNode& End = Nodes[*PointIndexMap.Find(Edge.End)];
+			const FNode& Start = Nodes[*Topology->PointIndexMap.Find(Edge.Start)];
+			const FNode& End = Nodes[*Topology->PointIndexMap.Find(Edge.End)];
 			EdgeOctree->AddElement(
 					FClusterItemRef(
 							Edge.EdgeIndex,
@@ -307,8 +365,8 @@ namespace PCGExCluster
 			auto ProcessCandidate = [&](const FClusterItemRef& Item)
 			{
 				const PCGExGraph::FIndexedEdge& Edge = Edges[Item.ItemIndex];
-				const FNode& Start = Nodes[*PointIndexMap.Find(Edge.Start)];
-				const FNode& End = Nodes[*PointIndexMap.Find(Edge.End)];
+				const FNode& Start = Nodes[*Topology->PointIndexMap.Find(Edge.Start)];
+				const FNode& End = Nodes[*Topology->PointIndexMap.Find(Edge.End)];
 				const double Dist = FMath::PointDistToSegmentSquared(Position, Start.Position, End.Position);
 				if (Dist < MaxDistance)
 				{
@@ -323,8 +381,8 @@ namespace PCGExCluster
 		{
 			for (const PCGExGraph::FIndexedEdge& Edge : Edges)
 			{
-				const FNode& Start = Nodes[*PointIndexMap.Find(Edge.Start)];
-				const FNode& End = Nodes[*PointIndexMap.Find(Edge.End)];
+				const FNode& Start = Nodes[*Topology->PointIndexMap.Find(Edge.Start)];
+				const FNode& End = Nodes[*Topology->PointIndexMap.Find(Edge.End)];
 				const double Dist = FMath::PointDistToSegmentSquared(Position, Start.Position, End.Position);
 				if (Dist < MaxDistance)
 				{
@@ -337,8 +395,8 @@ namespace PCGExCluster
 		if (ClosestIndex == -1) { return -1; }
 
 		const PCGExGraph::FIndexedEdge& Edge = Edges[ClosestIndex];
-		const FNode& Start = Nodes[*PointIndexMap.Find(Edge.Start)];
-		const FNode& End = Nodes[*PointIndexMap.Find(Edge.End)];
+		const FNode& Start = Nodes[*Topology->PointIndexMap.Find(Edge.Start)];
+		const FNode& End = Nodes[*Topology->PointIndexMap.Find(Edge.End)];
 
 		ClosestIndex = FVector::DistSquared(Position, Start.Position) < FVector::DistSquared(Position, End.Position) ? Start.NodeIndex : End.NodeIndex;
 
@@ -423,9 +481,16 @@ namespace PCGExCluster
 		return Result;
 	}
 
-	const FNode& FCluster::GetNodeFromPointIndex(const int32 Index) const { return Nodes[*PointIndexMap.Find(Index)]; }
+	const FNode& FCluster::GetNodeFromPointIndex(const int32 Index) const { return Nodes[*Topology->PointIndexMap.Find(Index)]; }
 
-	const PCGExGraph::FIndexedEdge& FCluster::GetEdgeFromNodeIndices(const int32 A, const int32 B) const { return Edges[*EdgeIndexMap.Find(PCGEx::H64U(A, B))]; }
+	int32 FCluster::FindEdgeIndex(const int32 A, const int32 B) const
+	{
+		const FClusterTopology& Adjacency = *Topology;
+		for (int i = Adjacency.AdjacencyOffsets[A]; i < Adjacency.AdjacencyOffsets[A + 1]; i++) { if (Adjacency.AdjacentNodeIndices[i] == B) { return Adjacency.AdjacentEdgeIndices[i]; } }
+		return -1;
+	}
+
+	const PCGExGraph::FIndexedEdge& FCluster::GetEdgeFromNodeIndices(const int32 A, const int32 B) const { return Edges[FindEdgeIndex(A, B)]; }
 
 	void FCluster::ComputeEdgeLengths(const bool bNormalize)
 	{
@@ -508,6 +573,164 @@ namespace PCGExCluster
 
 #pragma endregion
 
+#pragma region FClusterCache
+
+	FClusterCache& FClusterCache::Get()
+	{
+		static FClusterCache Instance;
+		return Instance;
+	}
+
+	bool FClusterCache::FEntry::Matches(const TArray<FPCGPoint>& InNodePoints, const TMap<int64, int32>& InNodeIndicesMap, const TArray<int32>& PerNodeEdgeNums) const
+	{
+		if (NumVtxPoints != InNodePoints.Num() || NodeVtxIds.Num() != Cluster->Nodes.Num()) { return false; }
+
+		for (const FNode& Node : Cluster->Nodes)
+		{
+			const int32* PointIndex = InNodeIndicesMap.Find(NodeVtxIds[Node.NodeIndex]);
+			if (!PointIndex || *PointIndex != Node.PointIndex) { return false; }
+			if (!PerNodeEdgeNums.IsValidIndex(Node.PointIndex) || PerNodeEdgeNums[Node.PointIndex] > Node.AdjacentNodes.Num()) { return false; }
+		}
+
+		return true;
+	}
+
+	FCluster* FClusterCache::TryGet(
+		const UPCGPointData* EdgesData,
+		const uint32 VtxTopologyCRC,
+		const TArray<FPCGPoint>& InNodePoints,
+		const TMap<int64, int32>& InNodeIndicesMap,
+		const TArray<int32>& PerNodeEdgeNums)
+	{
+		TSharedPtr<const FEntry> Entry;
+
+		{
+			FReadScopeLock ReadLock(CacheLock);
+			const TSharedPtr<FEntry>* Found = Entries.Find(TPair<uint64, uint32>(EdgesData->UID, VtxTopologyCRC));
+			if (!Found) { return nullptr; }
+			(*Found)->LastUsed.store(++UseCounter);
+			Entry = *Found;
+		}
+
+		// The key is only a CRC, make sure the cached nodes map onto the same vtx before using them
+		if (!Entry->Matches(InNodePoints, InNodeIndicesMap, PerNodeEdgeNums)) { return nullptr; }
+
+		FCluster* Cluster = new FCluster(*Entry->Cluster);
+		Cluster->RefreshPositions(InNodePoints);
+		return Cluster;
+	}
+
+	void FClusterCache::Add(
+		const UPCGPointData* EdgesData,
+		const uint32 VtxTopologyCRC,
+		const FCluster& InCluster,
+		const TArray<FPCGPoint>& InNodePoints,
+		const TMap<int64, int32>& InNodeIndicesMap)
+	{
+		const TSharedPtr<FEntry> NewEntry = MakeShared<FEntry>();
+
+		TArray<int64> PointVtxIds;
+		PointVtxIds.Init(-1, InNodePoints.Num());
+		for (const TPair<int64, int32>& Pair : InNodeIndicesMap) { if (PointVtxIds.IsValidIndex(Pair.Value)) { PointVtxIds[Pair.Value] = Pair.Key; } }
+
+		NewEntry->NodeVtxIds.SetNumUninitialized(InCluster.Nodes.Num());
+		for (const FNode& Node : InCluster.Nodes) { NewEntry->NodeVtxIds[Node.NodeIndex] = PointVtxIds[Node.PointIndex]; }
+		PointVtxIds.Empty();
+
+		NewEntry->NumVtxPoints = InNodePoints.Num();
+		NewEntry->AllocatedSize = InCluster.GetAllocatedSize() + NewEntry->NodeVtxIds.GetAllocatedSize();
+		if (NewEntry->AllocatedSize > MemoryBudget) { return; }
+
+		const TSharedPtr<FCluster> Cached = MakeShared<FCluster>(InCluster);
+		Cached->PointsIO = nullptr;
+		Cached->EdgesIO = nullptr;
+
+		NewEntry->EdgesData = EdgesData;
+		NewEntry->Cluster = Cached;
+		NewEntry->LastUsed.store(++UseCounter);
+
+		FWriteScopeLock WriteLock(CacheLock);
+
+		TSharedPtr<FEntry>& Entry = Entries.FindOrAdd(TPair<uint64, uint32>(EdgesData->UID, VtxTopologyCRC));
+		if (Entry) { UsedMemory -= Entry->AllocatedSize; }
+
+		Entry = NewEntry;
+		UsedMemory += NewEntry->AllocatedSize;
+
+		EvictToBudget();
+	}
+
+	void FClusterCache::PurgeStale()
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Value->EdgesData.IsValid()) { continue; }
+			UsedMemory -= It->Value->AllocatedSize;
+			It.RemoveCurrent();
+		}
+	}
+
+	void FClusterCache::Flush()
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+		Entries.Empty();
+		UsedMemory = 0;
+	}
+
+	void FClusterCache::EvictToBudget()
+	{
+		if (UsedMemory <= MemoryBudget) { return; }
+
+		TArray<TPair<uint64, TPair<uint64, uint32>>> ByUse; // LastUsed, Key
+		ByUse.Reserve(Entries.Num());
+		for (const TPair<TPair<uint64, uint32>, TSharedPtr<FEntry>>& Pair : Entries) { ByUse.Emplace(Pair.Value->LastUsed.load(), Pair.Key); }
+		ByUse.Sort([](const TPair<uint64, TPair<uint64, uint32>>& A, const TPair<uint64, TPair<uint64, uint32>>& B) { return A.Key < B.Key; });
+
+		for (const TPair<uint64, TPair<uint64, uint32>>& Oldest : ByUse)
+		{
+			if (UsedMemory <= MemoryBudget) { break; }
+			UsedMemory -= Entries.FindChecked(Oldest.Value)->AllocatedSize;
+			Entries.Remove(Oldest.Value);
+		}
+	}
+
+	uint32 ComputeVtxTopologyCRC(const TMap<int64, int32>& InNodeIndicesMap, const TArray<int32>& PerNodeEdgeNums)
+	{
+		uint32 CRC = FCrc::MemCrc32(PerNodeEdgeNums.GetData(), PerNodeEdgeNums.Num() * sizeof(int32));
+		for (const TPair<int64, int32>& Pair : InNodeIndicesMap)
+		{
+			CRC = FCrc::MemCrc32(&Pair.Key, sizeof(int64), CRC);
+			CRC = FCrc::MemCrc32(&Pair.Value, sizeof(int32), CRC);
+		}
+		return CRC;
+	}
+
+	FCluster* GetOrBuildCluster(
+		const PCGExData::FPointIO& EdgeIO,
+		const TArray<FPCGPoint>& InNodePoints,
+		const TMap<int64, int32>& InNodeIndicesMap,
+		const TArray<int32>& PerNodeEdgeNums,
+		const uint32 VtxTopologyCRC)
+	{
+		FClusterCache& Cache = FClusterCache::Get();
+		const UPCGPointData* EdgesData = EdgeIO.GetIn();
+
+		if (FCluster* CachedCluster = Cache.TryGet(EdgesData, VtxTopologyCRC, InNodePoints, InNodeIndicesMap, PerNodeEdgeNums)) { return CachedCluster; }
+
+		FCluster* NewCluster = new FCluster();
+		if (!NewCluster->BuildFrom(EdgeIO, InNodePoints, InNodeIndicesMap, PerNodeEdgeNums))
+		{
+			PCGEX_DELETE(NewCluster)
+			return nullptr;
+		}
+
+		Cache.Add(EdgesData, VtxTopologyCRC, *NewCluster, InNodePoints, InNodeIndicesMap);
+		return NewCluster;
+	}
+
+#pragma endregion
+
 #pragma region FNodeProjection
 
 	FNodeProjection::FNodeProjection(FNode* InNode)
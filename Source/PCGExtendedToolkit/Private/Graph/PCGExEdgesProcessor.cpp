@@ -94,6 +94,8 @@ bool FPCGExEdgesProcessorContext::AdvancePointsIO()
 		PCGExGraph::GetRemappedIndices(*CurrentIO, PCGExGraph::Tag_EdgeIndex, NodeIndicesMap);
 		EdgeNumReader = new PCGEx::TFAttributeReader<int32>(PCGExGraph::Tag_EdgesNum);
 		EdgeNumReader->Bind(*CurrentIO);
+
+		VtxTopologyCRC = PCGExCluster::ComputeVtxTopologyCRC(NodeIndicesMap, EdgeNumReader->Values);
 	}
 
 	return true;
@@ -113,18 +115,14 @@ bool FPCGExEdgesProcessorContext::AdvanceEdges(const bool bBuildCluster)
 		if (!bBuildCluster) { return true; }
 
 		CurrentEdges->CreateInKeys();
-		CurrentCluster = new PCGExCluster::FCluster();
-
-		if (!CurrentCluster->BuildFrom(
+		CurrentCluster = PCGExCluster::GetOrBuildCluster(
 			*CurrentEdges,
 			CurrentIO->GetIn()->GetPoints(),
 			NodeIndicesMap,
-			EdgeNumReader->Values))
-		{
-			// Bad cluster/edges.
-			PCGEX_DELETE(CurrentCluster)
-		}
-		else
+			EdgeNumReader->Values,
+			VtxTopologyCRC);
+
+		if (CurrentCluster) // Otherwise, bad cluster/edges.
 		{
 			CurrentCluster->PointsIO = CurrentIO;
 			CurrentCluster->EdgesIO = CurrentEdges;
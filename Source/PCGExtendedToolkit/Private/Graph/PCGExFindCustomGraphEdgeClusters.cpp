@@ -16,9 +16,6 @@ FPCGExFindCustomGraphEdgeClustersContext::~FPCGExFindCustomGraphEdgeClustersCont
 {
 	PCGEX_TERMINATE_ASYNC
 
-	UniqueEdges.Empty();
-	Edges.Empty();
-
 	PCGEX_DELETE(GraphBuilder)
 }
 
@@ -109,29 +106,16 @@ bool FPCGExFindCustomGraphEdgeClustersElement::ExecuteInternal(
 
 				if (End == -1 || PointIndex == End) { continue; }
 
-				const uint64 Hash = PCGEx::H64U(PointIndex, End);
-
 				const int32 InEdgeType = SocketInfo.Socket->GetEdgeTypeReader().Values[PointIndex];
 				if ((InEdgeType & EdgeType) == 0) { continue; }
 
-				{
-					FReadScopeLock ReadLock(Context->UniqueEdgesLock);
-					if (Context->UniqueEdges.Contains(Hash)) { continue; }
-				}
-				{
-					FWriteScopeLock WriteLock(Context->UniqueEdgesLock);
-					Context->UniqueEdges.Add(Hash);
-					Context->Edges.Emplace(PointIndex, End);
-				}
+				Context->EdgeBuffer.Add(PointIndex, End); // Duplicates are dropped when the buffer is inserted
 			}
 		};
 
 		if (!Context->ProcessCurrentPoints(InsertEdge)) { return false; }
 
-		Context->GraphBuilder->Graph->InsertEdges(Context->Edges, -1);
-
-		Context->UniqueEdges.Reset();
-		Context->Edges.Reset();
+		Context->GraphBuilder->Graph->InsertEdges(Context->EdgeBuffer, -1);
 
 		Context->SetState(PCGExGraph::State_ReadyForNextGraph);
 	}
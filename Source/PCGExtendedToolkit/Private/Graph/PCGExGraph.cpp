@@ -5,6 +5,7 @@
 
 #include "PCGExPointsProcessor.h"
 #include "Graph/PCGExCluster.h"
+#include "Algo/BinarySearch.h"
 
 namespace PCGExGraph
 {
@@ -31,18 +32,81 @@ namespace PCGExGraph
 		return -1;
 	}
 
-	bool FGraph::InsertEdge(const int32 A, const int32 B, FIndexedEdge& OutEdge)
+	bool FEdgeHashSet::Add(const uint64 Hash)
 	{
-		const uint64 Hash = PCGEx::H64U(A, B);
+		FShard& Shard = Shards[GetShardIndex(Hash)];
+		FWriteScopeLock WriteLock(Shard.Lock);
+		bool bAlreadySet = false;
+		Shard.Hashes.Add(Hash, &bAlreadySet);
+		return !bAlreadySet;
+	}
 
+	bool FEdgeHashSet::Contains(const uint64 Hash) const
+	{
+		const FShard& Shard = Shards[GetShardIndex(Hash)];
+		FReadScopeLock ReadLock(Shard.Lock);
+		return Shard.Hashes.Contains(Hash);
+	}
+
+	void FEdgeHashSet::Reserve(const int32 InNum)
+	{
+		const int32 PerShard = InNum / NumShards + 1;
+		for (FShard& Shard : Shards)
 		{
-			FReadScopeLock ReadLock(GraphLock);
-			if (UniqueEdges.Contains(Hash)) { return false; }
+			FWriteScopeLock WriteLock(Shard.Lock);
+			Shard.Hashes.Reserve(PerShard);
 		}
+	}
 
-		FWriteScopeLock WriteLock(GraphLock);
+	void FEdgeHashSet::Empty()
+	{
+		for (FShard& Shard : Shards)
+		{
+			FWriteScopeLock WriteLock(Shard.Lock);
+			Shard.Hashes.Empty();
+		}
+	}
 
-		UniqueEdges.Add(Hash);
+	int32 FEdgeHashSet::Num() const
+	{
+		int32 Total = 0;
+		for (const FShard& Shard : Shards)
+		{
+			FReadScopeLock ReadLock(Shard.Lock);
+			Total += Shard.Hashes.Num();
+		}
+		return Total;
+	}
+
+	void FEdgeBuffer::Add(const uint64 Hash)
+	{
+		FSlot& Slot = Slots[FPlatformTLS::GetCurrentThreadId() % NumSlots];
+		FWriteScopeLock WriteLock(Slot.Lock);
+		Slot.Hashes.Add(Hash);
+	}
+
+	int32 FEdgeBuffer::Num() const
+	{
+		int32 Total = 0;
+		for (const FSlot& Slot : Slots) { Total += Slot.Hashes.Num(); }
+		return Total;
+	}
+
+	void FEdgeBuffer::Drain(TArray<uint64>& OutHashes)
+	{
+		OutHashes.Reset(Num());
+		for (FSlot& Slot : Slots)
+		{
+			OutHashes.Append(Slot.Hashes);
+			Slot.Hashes.Empty();
+		}
+	}
+
+	bool FGraph::InsertEdge(const int32 A, const int32 B, FIndexedEdge& OutEdge)
+	{
+		if (!UniqueEdges.Add(PCGEx::H64U(A, B))) { return false; }
+
+		FWriteScopeLock WriteLock(GraphLock);
 
 		OutEdge = Edges.Emplace_GetRef(Edges.Num(), A, B);
 
@@ -54,17 +118,10 @@ namespace PCGExGraph
 
 	bool FGraph::InsertEdge(const FIndexedEdge& Edge)
 	{
-		const uint64 Hash = Edge.H64U();
-
-		{
-			FReadScopeLock ReadLock(GraphLock);
-			if (UniqueEdges.Contains(Hash)) { return false; }
-		}
+		if (!UniqueEdges.Add(Edge.H64U())) { return false; }
 
 		FWriteScopeLock WriteLock(GraphLock);
 
-		UniqueEdges.Add(Hash);
-
 		FIndexedEdge& NewEdge = Edges.Emplace_GetRef(Edge);
 		NewEdge.EdgeIndex = Edges.Num() - 1;
 
@@ -74,69 +131,181 @@ namespace PCGExGraph
 		return true;
 	}
 
-	void FGraph::InsertEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
+	template <typename FGetHash, typename FInitEdge>
+	void FGraph::InsertEdgesBulk(const int32 NumCandidates, FGetHash&& GetHash, FInitEdge&& InitEdge)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		uint32 A;
-		uint32 B;
-		for (const uint64& E : InEdges)
-		{
-			if (UniqueEdges.Contains(E)) { continue; }
+		if (NumCandidates <= 0) { return; }
+
+		const int32 NumWorkers = PCGExMT::GetNumPoolWorkers();
 
-			UniqueEdges.Add(E);
-			PCGEx::H64(E, A, B);
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			Nodes[A].Add(EdgeIndex);
-			Nodes[B].Add(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
+		TArray<uint64> Keys;
+		TArray<int32> Sources;
+		Keys.Reserve(NumCandidates);
+		Sources.Reserve(NumCandidates);
+
+		for (int i = 0; i < NumCandidates; i++)
+		{
+			uint64 Hash;
+			if (!GetHash(i, Hash)) { continue; }
+			Keys.Add(Hash);
+			Sources.Add(i);
 		}
-	}
 
-	void FGraph::InsertEdges(const TSet<uint64>& InEdges, const int32 InIOIndex)
-	{
+		// Stable sort keeps the first occurrence of each edge at the head of its run
+		PCGEx::RadixSort(Keys, Sources);
+
+		TArray<bool> Keep;
+		Keep.SetNumZeroed(NumCandidates);
+
+		PCGExMT::ParallelFor(
+			Keys.Num(), NumWorkers, [&](const int32 Index)
+			{
+				if (Index > 0 && Keys[Index - 1] == Keys[Index]) { return; }
+				if (UniqueEdges.Add(Keys[Index])) { Keep[Sources[Index]] = true; }
+			});
+
+		Keys.Empty();
+		Sources.Empty();
+
 		FWriteScopeLock WriteLock(GraphLock);
-		uint32 A;
-		uint32 B;
-		for (const uint64& E : InEdges)
+
+		const int32 FirstNewEdge = Edges.Num();
+		for (int i = 0; i < NumCandidates; i++)
+		{
+			if (!Keep[i]) { continue; }
+			FIndexedEdge& Edge = Edges.Emplace_GetRef();
+			Edge.EdgeIndex = Edges.Num() - 1;
+			InitEdge(i, Edge);
+		}
+
+		const int32 NumNewEdges = Edges.Num() - FirstNewEdge;
+		if (NumNewEdges == 0) { return; }
+
+		// New edge indices are unique by construction, so adjacency can be appended without AddUnique
+		const int32 NumNodes = Nodes.Num();
+
+		TArray<int32> Offsets;
+		Offsets.SetNumZeroed(NumNodes + 1);
+
+		for (int i = FirstNewEdge; i < Edges.Num(); i++)
 		{
-			if (UniqueEdges.Contains(E)) { continue; }
+			Offsets[Edges[i].Start + 1]++;
+			Offsets[Edges[i].End + 1]++;
+		}
+		for (int i = 0; i < NumNodes; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		TArray<int32> Adjacency;
+		Adjacency.SetNumUninitialized(Offsets[NumNodes]);
 
-			UniqueEdges.Add(E);
-			PCGEx::H64(E, A, B);
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			Nodes[A].Add(EdgeIndex);
-			Nodes[B].Add(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
+		{
+			TArray<int32> WriteIndices(Offsets.GetData(), NumNodes);
+			for (int i = FirstNewEdge; i < Edges.Num(); i++)
+			{
+				Adjacency[WriteIndices[Edges[i].Start]++] = i;
+				Adjacency[WriteIndices[Edges[i].End]++] = i;
+			}
 		}
+
+		PCGExMT::ParallelFor(
+			NumNodes, NumWorkers, [&](const int32 NodeIndex)
+			{
+				const int32 Count = Offsets[NodeIndex + 1] - Offsets[NodeIndex];
+				if (Count == 0) { return; }
+				Nodes[NodeIndex].Edges.Append(Adjacency.GetData() + Offsets[NodeIndex], Count);
+			});
+	}
+
+	void FGraph::InsertEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
+	{
+		InsertEdgesBulk(
+			InEdges.Num(),
+			[&](const int32 Index, uint64& OutHash)
+			{
+				OutHash = InEdges[Index];
+				return true;
+			},
+			[&](const int32 Index, FIndexedEdge& Edge)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(InEdges[Index], A, B);
+				Edge.Start = A;
+				Edge.End = B;
+				Edge.IOIndex = InIOIndex;
+			});
 	}
 
-#define PCGEX_EDGE_INSERT\
-	if (!E.bValid) { continue; } const uint64 Hash = E.H64U(); if (UniqueEdges.Contains(Hash)) { continue; }\
-	UniqueEdges.Add(Hash); const FIndexedEdge& Edge = Edges.Emplace_GetRef(Edges.Num(), E.Start, E.End);\
-	Nodes[E.Start].Add(Edge.EdgeIndex);	Nodes[E.End].Add(Edge.EdgeIndex);
+	void FGraph::InsertEdges(const TSet<uint64>& InEdges, const int32 InIOIndex)
+	{
+		InsertEdges(InEdges.Array(), InIOIndex);
+	}
 
 	void FGraph::InsertEdges(const TArray<FUnsignedEdge>& InEdges, const int32 InIOIndex)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		for (const FUnsignedEdge& E : InEdges)
-		{
-			PCGEX_EDGE_INSERT
-			Edges[Edge.EdgeIndex].IOIndex = InIOIndex;
-		}
+		InsertEdgesBulk(
+			InEdges.Num(),
+			[&](const int32 Index, uint64& OutHash)
+			{
+				if (!InEdges[Index].bValid) { return false; }
+				OutHash = InEdges[Index].H64U();
+				return true;
+			},
+			[&](const int32 Index, FIndexedEdge& Edge)
+			{
+				Edge.Start = InEdges[Index].Start;
+				Edge.End = InEdges[Index].End;
+				Edge.IOIndex = InIOIndex;
+			});
 	}
 
 	void FGraph::InsertEdges(const TArray<FIndexedEdge>& InEdges)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		for (const FIndexedEdge& E : InEdges)
-		{
-			PCGEX_EDGE_INSERT
-			Edges[Edge.EdgeIndex].IOIndex = E.IOIndex;
-			Edges[Edge.EdgeIndex].PointIndex = E.PointIndex;
-		}
+		InsertEdgesBulk(
+			InEdges.Num(),
+			[&](const int32 Index, uint64& OutHash)
+			{
+				if (!InEdges[Index].bValid) { return false; }
+				OutHash = InEdges[Index].H64U();
+				return true;
+			},
+			[&](const int32 Index, FIndexedEdge& Edge)
+			{
+				const FIndexedEdge& E = InEdges[Index];
+				Edge.Start = E.Start;
+				Edge.End = E.End;
+				Edge.IOIndex = E.IOIndex;
+				Edge.PointIndex = E.PointIndex;
+			});
 	}
 
-#undef PCGEX_EDGE_INSERT
+	void FGraph::InsertEdges(FEdgeBuffer& InBuffer, const int32 InIOIndex)
+	{
+		TArray<uint64> Hashes;
+		InBuffer.Drain(Hashes);
+
+		// Slots are filled in scheduling order; sort so the direction kept for a pair found from both ends doesn't depend on it
+		Hashes.Sort();
+
+		InsertEdgesBulk(
+			Hashes.Num(),
+			[&](const int32 Index, uint64& OutHash)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Hashes[Index], A, B);
+				OutHash = PCGEx::H64U(A, B);
+				return true;
+			},
+			[&](const int32 Index, FIndexedEdge& Edge)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Hashes[Index], A, B);
+				Edge.Start = A;
+				Edge.End = B;
+				Edge.IOIndex = InIOIndex;
+			});
+	}
 
 	TArrayView<FNode> FGraph::AddNodes(const int32 NumNewNodes)
 	{
@@ -155,59 +324,123 @@ namespace PCGExGraph
 
 	void FGraph::BuildSubGraphs(const int32 Min, const int32 Max)
 	{
-		TSet<int32> VisitedNodes;
-		VisitedNodes.Reserve(Nodes.Num());
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+		const int32 NumWorkers = PCGExMT::GetNumPoolWorkers();
 
-		for (int i = 0; i < Nodes.Num(); i++)
-		{
-			if (VisitedNodes.Contains(i)) { continue; }
+		auto IsExported = [&](const FIndexedEdge& Edge) { return Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid; };
+
+		// Lock-free union-find over exported edges.
+		// Roots are always linked under the smallest index, so each component is rooted at its smallest node
+		// and subgraphs come out in the same order as a node-ordered traversal would produce them.
+		const TUniquePtr<std::atomic<int32>[]> Parents = MakeUnique<std::atomic<int32>[]>(NumNodes);
 
-			const FNode& CurrentNode = Nodes[i];
-			if (!CurrentNode.bValid || // Points are valid by default, but may be invalidated prior to building the subgraph
-				CurrentNode.Edges.IsEmpty())
+		auto FindRoot = [&](int32 Index)
+		{
+			int32 Parent = Parents[Index].load(std::memory_order_acquire);
+			while (Parent != Index)
 			{
-				VisitedNodes.Add(i);
-				continue;
+				// Path halving; losing the race only means another thread already compressed further
+				int32 GrandParent = Parents[Parent].load(std::memory_order_acquire);
+				Parents[Index].compare_exchange_weak(Parent, GrandParent, std::memory_order_acq_rel);
+				Index = GrandParent;
+				Parent = Parents[Index].load(std::memory_order_acquire);
 			}
+			return Index;
+		};
 
-			FSubGraph* SubGraph = new FSubGraph();
-
-			TQueue<int32> Queue;
-			Queue.Enqueue(i);
-
-			int32 NextIndex = -1;
-			while (Queue.Dequeue(NextIndex))
+		PCGExMT::ParallelFor(
+			NumNodes, NumWorkers, [&](const int32 NodeIndex)
 			{
-				if (VisitedNodes.Contains(NextIndex)) { continue; }
-				VisitedNodes.Add(NextIndex);
+				Parents[NodeIndex].store(NodeIndex, std::memory_order_relaxed);
 
-				FNode& Node = Nodes[NextIndex];
+				FNode& Node = Nodes[NodeIndex];
 				Node.NumExportedEdges = 0;
+				if (!Node.bValid) { return; }
+				for (const int32 E : Node.Edges) { if (IsExported(Edges[E])) { Node.NumExportedEdges++; } }
+			});
 
-				for (const int32 E : Node.Edges)
-				{
-					const FIndexedEdge& Edge = Edges[E];
-					if (!Edge.bValid) { continue; }
-
-					int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+		PCGExMT::ParallelFor(
+			NumEdges, NumWorkers, [&](const int32 EdgeIndex)
+			{
+				const FIndexedEdge& Edge = Edges[EdgeIndex];
+				if (!IsExported(Edge)) { return; }
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
-					if (!VisitedNodes.Contains(OtherIndex)) { Queue.Enqueue(OtherIndex); }
+				while (true)
+				{
+					int32 RootA = FindRoot(Edge.Start);
+					int32 RootB = FindRoot(Edge.End);
+					if (RootA == RootB) { return; }
+					if (RootA < RootB) { Swap(RootA, RootB); }
+
+					// Only succeeds if RootA is still a root; otherwise try again from the new roots
+					int32 Expected = RootA;
+					if (Parents[RootA].compare_exchange_strong(Expected, RootB, std::memory_order_acq_rel)) { return; }
 				}
-			}
+			});
 
-			if (!FMath::IsWithin(SubGraph->Edges.Num(), FMath::Max(Min, 1), FMath::Max(Max, 1)))
+		TArray<int32> Roots;
+		Roots.SetNumUninitialized(NumNodes);
+		PCGExMT::ParallelFor(
+			NumNodes, NumWorkers, [&](const int32 NodeIndex)
 			{
-				SubGraph->Invalidate(this); // Will invalidate isolated points
-				delete SubGraph;
-			}
-			else
+				Roots[NodeIndex] = Nodes[NodeIndex].NumExportedEdges > 0 ? FindRoot(NodeIndex) : -1;
+			});
+
+		// Number components in root order, then bucket exported edges per component
+		TArray<int32> ComponentIndices;
+		ComponentIndices.SetNumUninitialized(NumNodes);
+
+		int32 NumComponents = 0;
+		for (int i = 0; i < NumNodes; i++) { ComponentIndices[i] = Roots[i] == i ? NumComponents++ : -1; }
+
+		if (NumComponents == 0) { return; }
+
+		TArray<int32> ComponentOffsets;
+		ComponentOffsets.SetNumZeroed(NumComponents + 1);
+
+		for (const FIndexedEdge& Edge : Edges) { if (IsExported(Edge)) { ComponentOffsets[ComponentIndices[Roots[Edge.Start]] + 1]++; } }
+		for (int i = 0; i < NumComponents; i++) { ComponentOffsets[i + 1] += ComponentOffsets[i]; }
+
+		TArray<int32> SortedEdges;
+		SortedEdges.SetNumUninitialized(ComponentOffsets[NumComponents]);
+
+		{
+			TArray<int32> WriteIndices(ComponentOffsets.GetData(), NumComponents);
+			for (const FIndexedEdge& Edge : Edges)
 			{
-				SubGraphs.Add(SubGraph);
+				if (!IsExported(Edge)) { continue; }
+				SortedEdges[WriteIndices[ComponentIndices[Roots[Edge.Start]]]++] = Edge.EdgeIndex;
 			}
 		}
+
+		TArray<FSubGraph*> Components;
+		Components.SetNumZeroed(NumComponents);
+
+		// Components are disjoint, so each one can be assembled & invalidated independently
+		PCGExMT::ParallelFor(
+			NumComponents, NumWorkers, [&](const int32 ComponentIndex)
+			{
+				const int32 NumComponentEdges = ComponentOffsets[ComponentIndex + 1] - ComponentOffsets[ComponentIndex];
+
+				FSubGraph* SubGraph = new FSubGraph();
+				SubGraph->Edges.Reserve(NumComponentEdges);
+				SubGraph->Nodes.Reserve(NumComponentEdges + 1);
+
+				for (int i = ComponentOffsets[ComponentIndex]; i < ComponentOffsets[ComponentIndex + 1]; i++) { SubGraph->Add(Edges[SortedEdges[i]], this); }
+
+				if (!FMath::IsWithin(NumComponentEdges, FMath::Max(Min, 1), FMath::Max(Max, 1)))
+				{
+					SubGraph->Invalidate(this); // Will invalidate isolated points
+					delete SubGraph;
+					return;
+				}
+
+				Components[ComponentIndex] = SubGraph;
+			});
+
+		SubGraphs.Reserve(SubGraphs.Num() + NumComponents);
+		for (FSubGraph* SubGraph : Components) { if (SubGraph) { SubGraphs.Add(SubGraph); } }
 	}
 
 	void FGraph::GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const
@@ -272,119 +505,403 @@ namespace PCGExGraph
 		return Center;
 	}
 
-	FCompoundNode* FCompoundGraph::GetOrCreateNode(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	// Largest per-axis offset between a point location and any spatialized center it can produce
+	static double GetSpatializedExtent(const FPCGPoint& Point)
 	{
-		const FVector Origin = Point.Transform.GetLocation();
-		int32 Index = -1;
-		if (FuseSettings.bComponentWiseTolerance)
+		const FVector Location = Point.Transform.GetLocation();
+		const FBox Box = Point.GetLocalBounds().TransformBy(Point.Transform);
+		return FMath::Max((Box.Max - Location).GetAbsMax(), (Box.Min - Location).GetAbsMax());
+	}
+
+	void FFuseGrid::Fuse(const TArray<PCGExData::FPointIO*>& InSources)
+	{
+		Anchors.Reset();
+		Members.Reset();
+		NodeOffsets.Reset();
+		NodeOffsets.Add(0);
+
+		const int32 NumWorkers = PCGExMT::GetNumPoolWorkers();
+		const bool bSpatialized = FuseSettings.SourceDistance != EPCGExDistance::Center || FuseSettings.TargetDistance != EPCGExDistance::Center;
+
+		int32 NumSources = 0;
+		FBox SourceBounds(ForceInit);
+		for (const PCGExData::FPointIO* Source : InSources)
 		{
-			FReadScopeLock ReadLock(OctreeLock);
-			const FBoxCenterAndExtent Box = FBoxCenterAndExtent(Origin, FuseSettings.Tolerances);
-			Octree.FindFirstElementWithBoundsTest(
-				Box, [&](const FCompoundNode* Node)
-				{
-					if (FuseSettings.IsWithinToleranceComponentWise(Point, Node->Point))
-					{
-						Index = Node->Index;
-						return false;
-					}
-					return true;
-				});
+			NumSources += Source->GetIn()->GetPoints().Num();
+			SourceBounds += Source->GetIn()->GetBounds();
+		}
 
-			if (Index != -1)
+		if (NumSources == 0) { return; }
+
+		TArray<const FPCGPoint*> Points;
+		TArray<uint64> Hashes;
+		Points.SetNumUninitialized(NumSources);
+		Hashes.SetNumUninitialized(NumSources);
+
+		double MaxExtent = 0;
+		int32 SourceOffset = 0;
+		for (const PCGExData::FPointIO* Source : InSources)
+		{
+			const TArray<FPCGPoint>& InPoints = Source->GetIn()->GetPoints();
+			for (int i = 0; i < InPoints.Num(); i++)
 			{
-				PointsCompounds->Add(Index, IOIndex, PointIndex);
-				return Nodes[Index];
+				Points[SourceOffset + i] = &InPoints[i];
+				Hashes[SourceOffset + i] = PCGEx::H64(Source->IOIndex, i);
+				if (bSpatialized) { MaxExtent = FMath::Max(MaxExtent, GetSpatializedExtent(InPoints[i])); }
 			}
+			SourceOffset += InPoints.Num();
 		}
-		else
-		{
-			FReadScopeLock ReadLock(OctreeLock);
-			const FBoxCenterAndExtent Box = FBoxCenterAndExtent(Origin, FVector(FuseSettings.Tolerance));
-			Octree.FindFirstElementWithBoundsTest(
-				Box, [&](const FCompoundNode* Node)
-				{
-					if (FuseSettings.IsWithinToleranceComponentWise(Point, Node->Point))
-					{
-						Index = Node->Index;
-						return false;
-					}
-					return true;
-				});
 
-			if (Index != -1)
+		// Cells wide enough for any fusable pair to sit in adjacent cells
+		const FFuseGridSpace Space(SourceBounds, FuseSettings.Tolerance + MaxExtent * 2);
+
+		TArray<uint64> Keys;
+		TArray<int32> Order;
+		Keys.SetNumUninitialized(NumSources);
+		Order.SetNumUninitialized(NumSources);
+
+		PCGExMT::ParallelFor(
+			NumSources, NumWorkers, [&](const int32 Index)
 			{
-				PointsCompounds->Add(Index, IOIndex, PointIndex);
-				return Nodes[Index];
-			}
+				Keys[Index] = Space.GetKey(Points[Index]->Transform.GetLocation());
+				Order[Index] = Index;
+			});
+
+		PCGEx::RadixSort(Keys, Order);
+
+		TArray<uint64> CellKeys;
+		TArray<int32> CellStarts;
+		for (int i = 0; i < NumSources; i++)
+		{
+			if (i > 0 && Keys[i] == Keys[i - 1]) { continue; }
+			CellKeys.Add(Keys[i]);
+			CellStarts.Add(i);
 		}
 
-		FCompoundNode* NewNode;
+		const int32 NumCells = CellKeys.Num();
+		CellStarts.Add(NumSources);
+		Keys.Empty();
+
+		// Canonical order within each cell, so input order has no say in anchor election
+		PCGExMT::ParallelFor(
+			NumCells, NumWorkers, [&](const int32 CellIndex)
+			{
+				MakeArrayView(Order.GetData() + CellStarts[CellIndex], CellStarts[CellIndex + 1] - CellStarts[CellIndex]).Sort(
+					[&](const int32 A, const int32 B)
+					{
+						const FVector PA = Points[A]->Transform.GetLocation();
+						const FVector PB = Points[B]->Transform.GetLocation();
+						if (PA.X != PB.X) { return PA.X < PB.X; }
+						if (PA.Y != PB.Y) { return PA.Y < PB.Y; }
+						if (PA.Z != PB.Z) { return PA.Z < PB.Z; }
+						return Hashes[A] < Hashes[B];
+					});
+			});
 
+		auto GetCellCoords = [](const uint64 Key)
+		{
+			return FIntVector(
+				static_cast<int32>(Key >> (FFuseGridSpace::CellBits * 2) & FFuseGridSpace::CellMask),
+				static_cast<int32>(Key >> FFuseGridSpace::CellBits & FFuseGridSpace::CellMask),
+				static_cast<int32>(Key & FFuseGridSpace::CellMask));
+		};
+
+		// Bucket cells into 27 phases; two cells of the same phase are never adjacent
+		constexpr int32 NumPhases = 27;
+		TArray<int32> PhaseStarts;
+		TArray<int32> PhaseCells;
+		PhaseStarts.SetNumZeroed(NumPhases + 1);
+		PhaseCells.SetNumUninitialized(NumCells);
+
+		TArray<int32> CellPhases;
+		CellPhases.SetNumUninitialized(NumCells);
+		for (int i = 0; i < NumCells; i++)
 		{
-			FWriteScopeLock WriteLock(OctreeLock);
-			NewNode = new FCompoundNode(Point, Origin, Nodes.Num());
-			Nodes.Add(NewNode);
-			Octree.AddElement(NewNode);
-			PointsCompounds->New()->Add(IOIndex, PointIndex);
+			const FIntVector Coords = GetCellCoords(CellKeys[i]);
+			CellPhases[i] = (Coords.X % 3) * 9 + (Coords.Y % 3) * 3 + Coords.Z % 3;
+			PhaseStarts[CellPhases[i] + 1]++;
 		}
+		for (int i = 0; i < NumPhases; i++) { PhaseStarts[i + 1] += PhaseStarts[i]; }
 
-		return NewNode;
-	}
+		{
+			TArray<int32> WriteIndices(PhaseStarts.GetData(), NumPhases);
+			for (int i = 0; i < NumCells; i++) { PhaseCells[WriteIndices[CellPhases[i]]++] = i; }
+		}
 
-	FCompoundNode* FCompoundGraph::GetOrCreateNodeUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
-	{
-		const FVector Origin = Point.Transform.GetLocation();
-		int32 Index = -1;
-		if (FuseSettings.bComponentWiseTolerance)
+		CellPhases.Empty();
+
+		// Anchors are stored as positions in the sorted order
+		TArray<TArray<int32>> CellAnchors;
+		CellAnchors.SetNum(NumCells);
+
+		TArray<int32> AssignedCells;
+		TArray<int32> AssignedAnchors;
+		AssignedCells.SetNumUninitialized(NumSources);
+		AssignedAnchors.SetNumUninitialized(NumSources);
+
+		for (int Phase = 0; Phase < NumPhases; Phase++)
 		{
-			const FBoxCenterAndExtent Box = FBoxCenterAndExtent(Origin, FuseSettings.Tolerances);
-			Octree.FindFirstElementWithBoundsTest(
-				Box, [&](const FCompoundNode* Node)
+			PCGExMT::ParallelFor(
+				PhaseStarts[Phase + 1] - PhaseStarts[Phase], NumWorkers, [&](const int32 Index)
 				{
-					if (FuseSettings.IsWithinToleranceComponentWise(Point, Node->Point))
+					const int32 CellIndex = PhaseCells[PhaseStarts[Phase] + Index];
+					const FIntVector Coords = GetCellCoords(CellKeys[CellIndex]);
+
+					// Own cell first, then neighbors in a fixed order
+					int32 Candidates[27];
+					int32 NumCandidates = 0;
+					Candidates[NumCandidates++] = CellIndex;
+
+					for (int32 X = -1; X <= 1; X++)
+					{
+						for (int32 Y = -1; Y <= 1; Y++)
+						{
+							for (int32 Z = -1; Z <= 1; Z++)
+							{
+								if (X == 0 && Y == 0 && Z == 0) { continue; }
+								const int32 Neighbor = Algo::BinarySearch(CellKeys, FFuseGridSpace::GetKey(Coords + FIntVector(X, Y, Z)));
+								if (Neighbor != INDEX_NONE) { Candidates[NumCandidates++] = Neighbor; }
+							}
+						}
+					}
+
+					TArray<int32>& OwnAnchors = CellAnchors[CellIndex];
+					for (int s = CellStarts[CellIndex]; s < CellStarts[CellIndex + 1]; s++)
 					{
-						Index = Node->Index;
-						return false;
+						const FPCGPoint& Point = *Points[Order[s]];
+						const FVector Position = Point.Transform.GetLocation();
+
+						int32 BestCell = -1;
+						int32 BestAnchor = -1;
+						double BestDist = MAX_dbl;
+
+						for (int c = 0; c < NumCandidates; c++)
+						{
+							const TArray<int32>& Candidate = CellAnchors[Candidates[c]];
+							for (int a = 0; a < Candidate.Num(); a++)
+							{
+								const FPCGPoint& AnchorPoint = *Points[Order[Candidate[a]]];
+								if (!FuseSettings.IsWithinToleranceComponentWise(Point, AnchorPoint)) { continue; }
+
+								const double Dist = FVector::DistSquared(Position, AnchorPoint.Transform.GetLocation());
+								if (Dist >= BestDist) { continue; }
+
+								BestDist = Dist;
+								BestCell = Candidates[c];
+								BestAnchor = a;
+							}
+						}
+
+						if (BestCell == -1)
+						{
+							BestCell = CellIndex;
+							BestAnchor = OwnAnchors.Add(s);
+						}
+
+						AssignedCells[s] = BestCell;
+						AssignedAnchors[s] = BestAnchor;
 					}
-					return true;
 				});
+		}
+
+		// Number nodes cell by cell
+		TArray<int32> CellNodeStarts;
+		CellNodeStarts.SetNumUninitialized(NumCells + 1);
+		CellNodeStarts[0] = 0;
+		for (int i = 0; i < NumCells; i++) { CellNodeStarts[i + 1] = CellNodeStarts[i] + CellAnchors[i].Num(); }
 
-			if (Index != -1)
+		const int32 NumNodes = CellNodeStarts[NumCells];
+		Anchors.SetNumUninitialized(NumNodes);
+
+		PCGExMT::ParallelFor(
+			NumCells, NumWorkers, [&](const int32 CellIndex)
 			{
-				PointsCompounds->Add(Index, IOIndex, PointIndex);
-				return Nodes[Index];
-			}
+				const TArray<int32>& OwnAnchors = CellAnchors[CellIndex];
+				for (int a = 0; a < OwnAnchors.Num(); a++) { Anchors[CellNodeStarts[CellIndex] + a] = Hashes[Order[OwnAnchors[a]]]; }
+			});
+
+		TArray<int32> SourceNodes;
+		SourceNodes.SetNumUninitialized(NumSources);
+
+		PCGExMT::ParallelFor(
+			NumSources, NumWorkers, [&](const int32 s)
+			{
+				SourceNodes[Order[s]] = CellNodeStarts[AssignedCells[s]] + AssignedAnchors[s];
+			});
+
+		// Members keep source order within each node
+		NodeOffsets.SetNumZeroed(NumNodes + 1);
+		for (const int32 NodeIndex : SourceNodes) { NodeOffsets[NodeIndex + 1]++; }
+		for (int i = 0; i < NumNodes; i++) { NodeOffsets[i + 1] += NodeOffsets[i]; }
+
+		Members.SetNumUninitialized(NumSources);
+		TArray<int32> WriteIndices(NodeOffsets.GetData(), NumNodes);
+		for (int i = 0; i < NumSources; i++) { Members[WriteIndices[SourceNodes[i]]++] = Hashes[i]; }
+	}
+
+	void FCompoundGraph::InsertPoints(const TArray<PCGExData::FPointIO*>& InSources)
+	{
+		FFuseGrid Grid(FuseSettings);
+		Grid.Fuse(InSources);
+
+		const int32 NumNewNodes = Grid.NumNodes();
+		if (NumNewNodes == 0) { return; }
+
+		TMap<int32, const PCGExData::FPointIO*> SourcesByIOIndex;
+		for (const PCGExData::FPointIO* Source : InSources) { SourcesByIOIndex.Add(Source->IOIndex, Source); }
+
+		FWriteScopeLock WriteLock(GridLock);
+
+		const int32 StartIndex = Nodes.Num();
+		Nodes.SetNum(StartIndex + NumNewNodes);
+		PointsCompounds->Compounds.SetNum(StartIndex + NumNewNodes);
+
+		PCGExMT::ParallelFor(
+			NumNewNodes, PCGExMT::GetNumPoolWorkers(), [&](const int32 Index)
+			{
+				const uint64 Anchor = Grid.Anchors[Index];
+				const FPCGPoint& Point = (*SourcesByIOIndex.Find(PCGEx::H64A(Anchor)))->GetInPoint(PCGEx::H64B(Anchor));
+
+				Nodes[StartIndex + Index] = new FCompoundNode(Point, Point.Transform.GetLocation(), StartIndex + Index);
+
+				PCGExData::FIdxCompound* Compound = new PCGExData::FIdxCompound();
+				Compound->CompoundedPoints.Append(Grid.Members.GetData() + Grid.NodeOffsets[Index], Grid.NodeOffsets[Index + 1] - Grid.NodeOffsets[Index]);
+				PointsCompounds->Compounds[StartIndex + Index] = Compound;
+			});
+	}
+
+	int32 FCompoundGraph::FindNode(const FPCGPoint& Point) const
+	{
+		const FVector Origin = Point.Transform.GetLocation();
+		const FIntVector Coords = GridSpace.GetCoords(Origin);
+
+		const double Reach = FuseSettings.Tolerance + (bSpatializedDistance ? GetSpatializedExtent(Point) + MaxNodeExtent : 0);
+		const int32 Radius = FMath::Max(1, FMath::CeilToInt(FMath::Min(Reach / GridSpace.CellSize, static_cast<double>(FFuseGridSpace::CellMask))));
+
+		// Closest node within tolerance, ties go to the lowest index
+		int32 BestIndex = -1;
+		double BestDist = MAX_dbl;
+
+		auto TestNode = [&](const int32 NodeIndex)
+		{
+			const FCompoundNode* Node = Nodes[NodeIndex];
+			if (!FuseSettings.IsWithinToleranceComponentWise(Point, Node->Point)) { return; }
+
+			const double Dist = FVector::DistSquared(Origin, Node->Point.Transform.GetLocation());
+			if (Dist > BestDist || (Dist == BestDist && NodeIndex > BestIndex)) { return; }
+
+			BestDist = Dist;
+			BestIndex = NodeIndex;
+		};
+
+		// A query reaching further than the cells were sized for (i.e a point larger than any indexed node)
+		// would visit more cells than there are nodes; scan the nodes instead.
+		const double NumCellsToVisit = FMath::Pow(2.0 * Radius + 1, 3);
+		if (NumCellsToVisit > NumGridNodes)
+		{
+			for (int i = 0; i < NumGridNodes; i++) { TestNode(i); }
+			return BestIndex;
 		}
-		else
+
+		for (int32 X = Coords.X - Radius; X <= Coords.X + Radius; X++)
 		{
-			const FBoxCenterAndExtent Box = FBoxCenterAndExtent(Origin, FVector(FuseSettings.Tolerance));
-			Octree.FindFirstElementWithBoundsTest(
-				Box, [&](const FCompoundNode* Node)
+			if (X < 0 || X > FFuseGridSpace::CellMask) { continue; }
+			for (int32 Y = Coords.Y - Radius; Y <= Coords.Y + Radius; Y++)
+			{
+				if (Y < 0 || Y > FFuseGridSpace::CellMask) { continue; }
+				for (int32 Z = Coords.Z - Radius; Z <= Coords.Z + Radius; Z++)
 				{
-					if (FuseSettings.IsWithinToleranceComponentWise(Point, Node->Point))
-					{
-						Index = Node->Index;
-						return false;
-					}
-					return true;
-				});
+					if (Z < 0 || Z > FFuseGridSpace::CellMask) { continue; }
 
-			if (Index != -1)
-			{
-				PointsCompounds->Add(Index, IOIndex, PointIndex);
-				return Nodes[Index];
+					const TArray<int32, TInlineAllocator<4>>* Cell = GridCells.Find(FFuseGridSpace::GetKey(FIntVector(X, Y, Z)));
+					if (!Cell) { continue; }
+
+					for (const int32 NodeIndex : *Cell) { TestNode(NodeIndex); }
+				}
 			}
 		}
 
+		return BestIndex;
+	}
+
+	FCompoundNode* FCompoundGraph::CreateNode(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		const FVector Origin = Point.Transform.GetLocation();
+
 		FCompoundNode* NewNode = new FCompoundNode(Point, Origin, Nodes.Num());
 		Nodes.Add(NewNode);
-		Octree.AddElement(NewNode);
 		PointsCompounds->New()->Add(IOIndex, PointIndex);
 
+		GridCells.FindOrAdd(GridSpace.GetKey(Origin)).Add(NewNode->Index);
+		if (bSpatializedDistance) { MaxNodeExtent = FMath::Max(MaxNodeExtent, GetSpatializedExtent(Point)); }
+		NumGridNodes = Nodes.Num();
+
+		GrowGrid();
+
 		return NewNode;
 	}
 
+	void FCompoundGraph::IndexPendingNodes()
+	{
+		for (int i = NumGridNodes; i < Nodes.Num(); i++)
+		{
+			const FPCGPoint& Point = Nodes[i]->Point;
+			GridCells.FindOrAdd(GridSpace.GetKey(Point.Transform.GetLocation())).Add(i);
+			if (bSpatializedDistance) { MaxNodeExtent = FMath::Max(MaxNodeExtent, GetSpatializedExtent(Point)); }
+		}
+
+		NumGridNodes = Nodes.Num();
+
+		GrowGrid();
+	}
+
+	void FCompoundGraph::GrowGrid()
+	{
+		// Same sizing as FFuseGrid : any fusable pair of indexed nodes sits in adjacent cells
+		const double MinCellSize = FuseSettings.Tolerance + MaxNodeExtent * 2;
+		if (MinCellSize <= GridSpace.CellSize) { return; }
+
+		// Overshoot so that steadily growing extents only trigger a logarithmic number of rebuilds
+		GridSpace = FFuseGridSpace(Bounds, MinCellSize * 2);
+
+		GridCells.Reset();
+		for (int i = 0; i < NumGridNodes; i++) { GridCells.FindOrAdd(GridSpace.GetKey(Nodes[i]->Point.Transform.GetLocation())).Add(i); }
+	}
+
+	FCompoundNode* FCompoundGraph::GetOrCreateNode(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		int32 Index = -1;
+
+		{
+			FReadScopeLock ReadLock(GridLock);
+			if (NumGridNodes == Nodes.Num()) { Index = FindNode(Point); }
+		}
+
+		FWriteScopeLock WriteLock(GridLock);
+
+		if (Index == -1)
+		{
+			// Another thread may have created a matching node in the meantime
+			IndexPendingNodes();
+			Index = FindNode(Point);
+			if (Index == -1) { return CreateNode(Point, IOIndex, PointIndex); }
+		}
+
+		PointsCompounds->Add(Index, IOIndex, PointIndex);
+		return Nodes[Index];
+	}
+
+	FCompoundNode* FCompoundGraph::GetOrCreateNodeUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		IndexPendingNodes();
+
+		const int32 Index = FindNode(Point);
+		if (Index == -1) { return CreateNode(Point, IOIndex, PointIndex); }
+
+		PointsCompounds->Add(Index, IOIndex, PointIndex);
+		return Nodes[Index];
+	}
+
 	PCGExData::FIdxCompound* FCompoundGraph::CreateBridge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
 	{
 		FCompoundNode* StartVtx = GetOrCreateNode(From, FromIOIndex, FromPointIndex);
@@ -457,14 +974,20 @@ namespace PCGExGraph
 		UniqueEdges.Empty();
 	}
 
-	void FCompoundGraph::WriteMetadata(TMap<int32, FGraphNodeMetadata*>& OutMetadata)
+	void FCompoundGraph::WriteMetadata(FGraphNodeMetadata& OutMetadata)
 	{
-		for (const FCompoundNode* Node : Nodes)
-		{
-			FGraphNodeMetadata* NodeMeta = FGraphNodeMetadata::GetOrCreate(Node->Index, OutMetadata);
-			NodeMeta->CompoundSize = Node->Neighbors.Num();
-			NodeMeta->bCompounded = NodeMeta->CompoundSize > 1;
-		}
+		int32 MaxIndex = -1;
+		for (const FCompoundNode* Node : Nodes) { MaxIndex = FMath::Max(MaxIndex, Node->Index); }
+
+		OutMetadata.Grow(MaxIndex + 1);
+
+		PCGExMT::ParallelFor(
+			Nodes.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				const FCompoundNode* Node = Nodes[i];
+				OutMetadata.CompoundSize[Node->Index] = Node->Neighbors.Num();
+				if (OutMetadata.Type[Node->Index] == EPCGExIntersectionType::Unknown) { OutMetadata.Type[Node->Index] = EPCGExIntersectionType::PointEdge; }
+			});
 	}
 
 	bool FPointEdgeProxy::FindSplit(const FVector& Position, FPESplit& OutSplit) const
@@ -487,19 +1010,77 @@ namespace PCGExGraph
 		: PointIO(InPointIO), Graph(InGraph), CompoundGraph(InCompoundGraph), Settings(InSettings)
 	{
 		const TArray<FPCGPoint>& Points = InPointIO->GetOutIn()->GetPoints();
+		const double Tolerance = Settings.FuseSettings.Tolerance;
 
 		const int32 NumEdges = InGraph->Edges.Num();
 		Edges.SetNum(NumEdges);
 
-		for (const FIndexedEdge& Edge : InGraph->Edges)
+		PCGExMT::ParallelFor(
+			NumEdges, PCGExMT::GetNumPoolWorkers(), [&](const int32 EdgeIndex)
+			{
+				const FIndexedEdge& Edge = InGraph->Edges[EdgeIndex];
+				if (!Edge.bValid) { return; }
+				Edges[EdgeIndex].Init(
+					EdgeIndex,
+					Points[Edge.Start].Transform.GetLocation(),
+					Points[Edge.End].Transform.GetLocation(),
+					Tolerance);
+			});
+
+		// Bucket valid nodes
+
+		TArray<int32> Nodes;
+		Nodes.Reserve(InGraph->Nodes.Num());
+
+		FBox Bounds = FBox(ForceInit);
+		for (const FNode& Node : InGraph->Nodes)
 		{
-			if (!Edge.bValid) { continue; }
-			Edges[Edge.EdgeIndex].Init(
-				Edge.EdgeIndex,
-				Points[Edge.Start].Transform.GetLocation(),
-				Points[Edge.End].Transform.GetLocation(),
-				Settings.FuseSettings.Tolerance);
+			if (!Node.bValid || !Points.IsValidIndex(Node.PointIndex)) { continue; }
+			Nodes.Add(Node.NodeIndex);
+			Bounds += Points[Node.PointIndex].Transform.GetLocation();
+		}
+
+		const int32 NumNodes = Nodes.Num();
+		if (NumNodes == 0) { return; }
+
+		// Size cells from the average spacing over non-degenerate axes, aiming at a handful of points per cell
+
+		const FVector Size = Bounds.GetSize();
+		double Measure = 1;
+		int32 NumDimensions = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			if (Size[i] <= Tolerance) { continue; }
+			Measure *= Size[i];
+			NumDimensions++;
 		}
+
+		const double Spacing = NumDimensions ? FMath::Pow(Measure / NumNodes, 1.0 / NumDimensions) : Tolerance;
+		GridSpace = FFuseGridSpace(Bounds.ExpandBy(Tolerance), FMath::Max(Tolerance, Spacing * 2));
+
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(NumNodes);
+
+		PCGExMT::ParallelFor(
+			NumNodes, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				Keys[i] = GridSpace.GetKey(Points[InGraph->Nodes[Nodes[i]].PointIndex].Transform.GetLocation());
+			});
+
+		PCGEx::RadixSort(Keys, Nodes);
+
+		CellNodes = MoveTemp(Nodes);
+		CellKeys.Reserve(NumNodes);
+		CellOffsets.Reserve(NumNodes + 1);
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			if (i > 0 && Keys[i] == Keys[i - 1]) { continue; }
+			CellKeys.Add(Keys[i]);
+			CellOffsets.Add(i);
+		}
+
+		CellOffsets.Add(NumNodes);
 	}
 
 	void FPointEdgeIntersections::FindIntersections(FPCGExPointsProcessorContext* InContext)
@@ -511,9 +1092,83 @@ namespace PCGExGraph
 		}
 	}
 
+	void FPointEdgeIntersections::GetCandidateNodes(const FPointEdgeProxy& Edge, TArray<int32>& OutNodes) const
+	{
+		OutNodes.Reset();
+		if (CellKeys.IsEmpty()) { return; }
+
+		TArray<uint64, TInlineAllocator<256>> Cells;
+
+		auto AddNeighborhood = [&](const FIntVector& Coords)
+		{
+			for (int x = -1; x <= 1; x++)
+			{
+				for (int y = -1; y <= 1; y++)
+				{
+					for (int z = -1; z <= 1; z++)
+					{
+						const FIntVector Cell = Coords + FIntVector(x, y, z);
+						const FVector CellMin = GridSpace.Origin + FVector(Cell) * GridSpace.CellSize;
+						if (!Edge.Box.Intersect(FBox(CellMin, CellMin + FVector(GridSpace.CellSize)))) { continue; }
+						Cells.Add(FFuseGridSpace::GetKey(Cell));
+					}
+				}
+			}
+		};
+
+		// 3D DDA along the segment
+
+		FIntVector Coords = GridSpace.GetCoords(Edge.Start);
+		const FIntVector EndCoords = GridSpace.GetCoords(Edge.End);
+
+		const FVector From = (Edge.Start - GridSpace.Origin) / GridSpace.CellSize;
+		const FVector Dir = (Edge.End - GridSpace.Origin) / GridSpace.CellSize - From;
+
+		FIntVector Step = FIntVector::ZeroValue;
+		FVector TMax = FVector(MAX_dbl);
+		FVector TDelta = FVector(MAX_dbl);
+
+		for (int i = 0; i < 3; i++)
+		{
+			if (FMath::IsNearlyZero(Dir[i])) { continue; }
+			Step[i] = Dir[i] > 0 ? 1 : -1;
+			TDelta[i] = FMath::Abs(1 / Dir[i]);
+			const double Boundary = Coords[i] + (Step[i] > 0 ? 1 : 0);
+			TMax[i] = (Boundary - From[i]) / Dir[i];
+		}
+
+		const int32 NumSteps = FMath::Abs(EndCoords.X - Coords.X) + FMath::Abs(EndCoords.Y - Coords.Y) + FMath::Abs(EndCoords.Z - Coords.Z);
+
+		AddNeighborhood(Coords);
+		for (int s = 0; s < NumSteps; s++)
+		{
+			const int32 Axis = TMax.X < TMax.Y ? (TMax.X < TMax.Z ? 0 : 2) : (TMax.Y < TMax.Z ? 1 : 2);
+			if (Step[Axis] == 0) { break; }
+			Coords[Axis] += Step[Axis];
+			TMax[Axis] += TDelta[Axis];
+			AddNeighborhood(Coords);
+		}
+
+		if (Coords != EndCoords) { AddNeighborhood(EndCoords); } // Numerical drift
+
+		Cells.Sort();
+
+		uint64 LastKey = 0;
+		for (int i = 0; i < Cells.Num(); i++)
+		{
+			const uint64 Key = Cells[i];
+			if (i > 0 && Key == LastKey) { continue; }
+			LastKey = Key;
+
+			const int32 CellIndex = Algo::BinarySearch(CellKeys, Key);
+			if (CellIndex == INDEX_NONE) { continue; }
+
+			OutNodes.Append(&CellNodes[CellOffsets[CellIndex]], CellOffsets[CellIndex + 1] - CellOffsets[CellIndex]);
+		}
+	}
+
 	void FPointEdgeIntersections::Add(const int32 EdgeIndex, const FPESplit& Split)
 	{
-		FWriteScopeLock WriteLock(InsertionLock);
 		Edges[EdgeIndex].CollinearPoints.AddUnique(Split);
 	}
 
@@ -521,6 +1176,8 @@ namespace PCGExGraph
 	{
 		FIndexedEdge NewEdge = FIndexedEdge{};
 
+		Graph->NodeMetadata.Grow(Graph->Nodes.Num());
+
 		for (FPointEdgeProxy& PointEdgeProxy : Edges)
 		{
 			if (PointEdgeProxy.CollinearPoints.IsEmpty()) { continue; }
@@ -542,11 +1199,8 @@ namespace PCGExGraph
 				Graph->InsertEdge(PrevIndex, NodeIndex, NewEdge);
 				PrevIndex = NodeIndex;
 
-				FGraphNodeMetadata* NodeMetadata = FGraphNodeMetadata::GetOrCreate(NodeIndex, Graph->NodeMetadata);
-				NodeMetadata->Type = EPCGExIntersectionType::PointEdge;
-
-				FGraphEdgeMetadata* EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(NewEdge.EdgeIndex, SplitEdge.EdgeIndex, Graph->EdgeMetadata);
-				EdgeMetadata->Type = EPCGExIntersectionType::PointEdge;
+				Graph->NodeMetadata.Type[NodeIndex] = EPCGExIntersectionType::PointEdge;
+				Graph->EdgeMetadata.Set(NewEdge.EdgeIndex, SplitEdge.EdgeIndex, EPCGExIntersectionType::PointEdge);
 
 				if (Settings.bSnapOnEdge)
 				{
@@ -581,6 +1235,88 @@ namespace PCGExGraph
 		return true;
 	}
 
+	void FEdgeBVH::Build(const TArray<FEdgeEdgeProxy>& Proxies)
+	{
+		Empty();
+
+		Positions.Init(-1, Proxies.Num());
+
+		FBox Bounds = FBox(ForceInit);
+		for (const FEdgeEdgeProxy& Proxy : Proxies)
+		{
+			if (Proxy.EdgeIndex == -1) { continue; }
+			Order.Add(Proxy.EdgeIndex);
+			Bounds += Proxy.Box;
+		}
+
+		const int32 NumItems = Order.Num();
+		if (NumItems == 0) { return; }
+
+		// Sort along a 63bit morton curve of the box centers
+
+		constexpr uint64 AxisMask = (1 << 21) - 1;
+		const FVector Scale = FVector(static_cast<double>(AxisMask)) / Bounds.GetSize().ComponentMax(FVector(UE_SMALL_NUMBER));
+
+		auto Spread = [](uint64 V)
+		{
+			V &= 0x1fffff;
+			V = (V | V << 32) & 0x1f00000000ffff;
+			V = (V | V << 16) & 0x1f0000ff0000ff;
+			V = (V | V << 8) & 0x100f00f00f00f00f;
+			V = (V | V << 4) & 0x10c30c30c30c30c3;
+			V = (V | V << 2) & 0x1249249249249249;
+			return V;
+		};
+
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(NumItems);
+
+		PCGExMT::ParallelFor(
+			NumItems, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				const FVector Local = (Proxies[Order[i]].Box.GetCenter() - Bounds.Min) * Scale;
+				Keys[i] = Spread(static_cast<uint64>(Local.X)) | Spread(static_cast<uint64>(Local.Y)) << 1 | Spread(static_cast<uint64>(Local.Z)) << 2;
+			});
+
+		PCGEx::RadixSort(Keys, Order);
+		Keys.Empty();
+
+		for (int i = 0; i < NumItems; i++) { Positions[Order[i]] = i; }
+
+		// Leaves
+
+		int32 NumLevelNodes = FMath::DivideAndRoundUp(NumItems, LeafSize);
+		LevelOffsets.Add(0);
+		NodeBounds.SetNumUninitialized(NumLevelNodes);
+
+		PCGExMT::ParallelFor(
+			NumLevelNodes, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				FBox LeafBounds = FBox(ForceInit);
+				const int32 End = FMath::Min((i + 1) * LeafSize, NumItems);
+				for (int j = i * LeafSize; j < End; j++) { LeafBounds += Proxies[Order[j]].Box; }
+				NodeBounds[i] = LeafBounds;
+			});
+
+		// Upper levels, pairing consecutive nodes until a single root remains
+
+		while (NumLevelNodes > 1)
+		{
+			const int32 ChildOffset = LevelOffsets.Last();
+			const int32 NumChildren = NumLevelNodes;
+
+			NumLevelNodes = FMath::DivideAndRoundUp(NumChildren, 2);
+			LevelOffsets.Add(NodeBounds.Num());
+			NodeBounds.Reserve(NodeBounds.Num() + NumLevelNodes);
+
+			for (int i = 0; i < NumLevelNodes; i++)
+			{
+				const int32 Left = ChildOffset + i * 2;
+				NodeBounds.Add(i * 2 + 1 < NumChildren ? NodeBounds[Left] + NodeBounds[Left + 1] : NodeBounds[Left]);
+			}
+		}
+	}
+
 	FEdgeEdgeIntersections::FEdgeEdgeIntersections(
 		FGraph* InGraph,
 		FCompoundGraph* InCompoundGraph,
@@ -593,19 +1329,19 @@ namespace PCGExGraph
 		const int32 NumEdges = InGraph->Edges.Num();
 		Edges.SetNum(NumEdges);
 
-		Octree = TEdgeOctree(InCompoundGraph->Bounds.GetCenter(), InCompoundGraph->Bounds.GetExtent().Length() + (Settings.Tolerance * 2));
-
-		for (const FIndexedEdge& Edge : InGraph->Edges)
-		{
-			if (!Edge.bValid) { continue; }
-			Edges[Edge.EdgeIndex].Init(
-				Edge.EdgeIndex,
-				Points[Edge.Start].Transform.GetLocation(),
-				Points[Edge.End].Transform.GetLocation(),
-				Settings.Tolerance);
+		PCGExMT::ParallelFor(
+			NumEdges, PCGExMT::GetNumPoolWorkers(), [&](const int32 EdgeIndex)
+			{
+				const FIndexedEdge& Edge = InGraph->Edges[EdgeIndex];
+				if (!Edge.bValid) { return; }
+				Edges[EdgeIndex].Init(
+					EdgeIndex,
+					Points[Edge.Start].Transform.GetLocation(),
+					Points[Edge.End].Transform.GetLocation(),
+					Settings.Tolerance);
+			});
 
-			Octree.AddElement(&Edges[Edge.EdgeIndex]);
-		}
+		BVH.Build(Edges);
 	}
 
 	void FEdgeEdgeIntersections::FindIntersections(FPCGExPointsProcessorContext* InContext)
@@ -619,26 +1355,34 @@ namespace PCGExGraph
 
 	void FEdgeEdgeIntersections::Add(const int32 EdgeIndex, const int32 OtherEdgeIndex, const FEESplit& Split)
 	{
-		FWriteScopeLock WriteLock(InsertionLock);
-
-		CheckedPairs.Add(PCGEx::H64U(EdgeIndex, OtherEdgeIndex));
-
-		FEECrossing* OutSplit = new FEECrossing(Split);
-
-		OutSplit->NodeIndex = Crossings.Add(OutSplit) + Graph->Nodes.Num();
-		OutSplit->EdgeA = FMath::Min(EdgeIndex, OtherEdgeIndex);
-		OutSplit->EdgeB = FMath::Max(EdgeIndex, OtherEdgeIndex);
-
-		Edges[EdgeIndex].Intersections.AddUnique(OutSplit);
-		Edges[OtherEdgeIndex].Intersections.AddUnique(OutSplit);
+		// Split times are relative to the querying edge first; keep them paired with the edges they belong to
+		FEECrossing& Crossing = Edges[EdgeIndex].OwnedCrossings.Emplace_GetRef(Split);
+		Crossing.EdgeA = EdgeIndex;
+		Crossing.EdgeB = OtherEdgeIndex;
 	}
 
 	void FEdgeEdgeIntersections::Insert()
 	{
+		// Gather owned crossings in edge order so node indices don't depend on scheduling
+
+		const int32 NumNodes = Graph->Nodes.Num();
+		for (FEdgeEdgeProxy& Owner : Edges)
+		{
+			for (const FEECrossing& OwnedCrossing : Owner.OwnedCrossings)
+			{
+				FEECrossing* Crossing = new FEECrossing(OwnedCrossing);
+				Crossing->NodeIndex = Crossings.Add(Crossing) + NumNodes;
+				Edges[Crossing->EdgeA].Intersections.Add(Crossing);
+				Edges[Crossing->EdgeB].Intersections.Add(Crossing);
+			}
+			Owner.OwnedCrossings.Empty();
+		}
+
 		FIndexedEdge NewEdge = FIndexedEdge{};
 
 		// Insert new nodes
 		const TArrayView<FNode> NewNodes = Graph->AddNodes(Crossings.Num());
+		Graph->NodeMetadata.Grow(Graph->Nodes.Num());
 
 		TArray<FPCGPoint>& MutablePoints = PointIO->GetOut()->GetMutablePoints();
 		MutablePoints.SetNum(Graph->Nodes.Num());
@@ -672,11 +1416,8 @@ namespace PCGExGraph
 				Graph->InsertEdge(PrevIndex, NodeIndex, NewEdge);
 				PrevIndex = NodeIndex;
 
-				FGraphNodeMetadata* NodeMetadata = FGraphNodeMetadata::GetOrCreate(NodeIndex, Graph->NodeMetadata);
-				NodeMetadata->Type = EPCGExIntersectionType::EdgeEdge;
-
-				FGraphEdgeMetadata* EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(NewEdge.EdgeIndex, EdgeProxy.EdgeIndex, Graph->EdgeMetadata);
-				EdgeMetadata->Type = EPCGExIntersectionType::EdgeEdge;
+				Graph->NodeMetadata.Type[NodeIndex] = EPCGExIntersectionType::EdgeEdge;
+				Graph->EdgeMetadata.Set(NewEdge.EdgeIndex, EdgeProxy.EdgeIndex, EPCGExIntersectionType::EdgeEdge);
 			}
 
 			Graph->InsertEdge(NodeIndex, LastIndex, NewEdge); // Insert last edge
@@ -794,19 +1535,21 @@ namespace PCGExGraphTask
 
 		if (MetadataSettings && !Builder->Graph->NodeMetadata.IsEmpty())
 		{
+			const PCGExGraph::FGraphNodeMetadata& NodeMetadata = Builder->Graph->NodeMetadata;
+
 #define PCGEX_METADATA(_NAME, _TYPE, _DEFAULT, _ACCESSOR)\
 {if(MetadataSettings->bWrite##_NAME){\
-PCGEx::TFAttributeWriter<_TYPE>* Writer = MetadataSettings->bWrite##_NAME ? new PCGEx::TFAttributeWriter<_TYPE>(MetadataSettings->_NAME##AttributeName, _DEFAULT, false) : nullptr;\
+PCGEx::TFAttributeWriter<_TYPE>* Writer = new PCGEx::TFAttributeWriter<_TYPE>(MetadataSettings->_NAME##AttributeName, _DEFAULT, false);\
 Writer->BindAndGet(*PointIO);\
-		for(const int32 NodeIndex : ValidNodes){\
-		PCGExGraph::FGraphNodeMetadata** NodeMeta = Builder->Graph->NodeMetadata.Find(NodeIndex);\
-		if(NodeMeta){Writer->Values[Nodes[NodeIndex].PointIndex] = (*NodeMeta)->_ACCESSOR; }}\
+		PCGExMT::ParallelFor(ValidNodes.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i){\
+		const int32 NodeIndex = ValidNodes[i];\
+		Writer->Values[Nodes[NodeIndex].PointIndex] = NodeMetadata._ACCESSOR(NodeIndex); });\
 		Writer->Write(); delete Writer; }}
 
-			PCGEX_METADATA(Compounded, bool, false, bCompounded)
-			PCGEX_METADATA(CompoundSize, int32, 0, CompoundSize)
-			PCGEX_METADATA(Intersector, bool, false, IsIntersector())
-			PCGEX_METADATA(Crossing, bool, false, IsCrossing())
+			PCGEX_METADATA(Compounded, bool, false, IsCompounded)
+			PCGEX_METADATA(CompoundSize, int32, 0, GetCompoundSize)
+			PCGEX_METADATA(Intersector, bool, false, IsIntersector)
+			PCGEX_METADATA(Crossing, bool, false, IsCrossing)
 
 #undef PCGEX_METADATA
 		}
@@ -843,9 +1586,6 @@ Writer->BindAndGet(*PointIO);\
 				NumClusterIdWriter->Values[Builder->Graph->Nodes[Edge.Start].PointIndex] = ClusterId;
 				NumClusterIdWriter->Values[Builder->Graph->Nodes[Edge.End].PointIndex] = ClusterId;
 			}
-
-			//Manager->Start<FWriteSubGraphEdges>(SubGraphIndex++, PointIO, Builder->Graph, SubGraph, MetadataSettings);
-			WriteSubGraphEdges(PointIO->GetOut()->GetPoints(), Builder->Graph, SubGraph, MetadataSettings);
 		}
 
 		NumClusterIdWriter->Write();
@@ -853,34 +1593,12 @@ Writer->BindAndGet(*PointIO);\
 		PointIO->Tags->Set(PCGExGraph::TagStr_ClusterPair, Builder->PairIdStr);
 		PCGEX_DELETE(NumClusterIdWriter)
 
-		return true;
-	}
-
-	bool FCompoundGraphInsertPoints::ExecuteTask()
-	{
-		PointIO->CreateInKeys();
-
-		const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
-
-		TArray<int32> InSorted;
-		InSorted.SetNum(InPoints.Num());
-		for (int i = 0; i < InSorted.Num(); i++) { InSorted[i] = i; }
-
-		InSorted.Sort(
-			[&](const int32 A, const int32 B)
-			{
-				const FVector V = InPoints[A].Transform.GetLocation() - InPoints[B].Transform.GetLocation();
-				return FMath::IsNearlyZero(V.X) ? FMath::IsNearlyZero(V.Y) ? V.Z > 0 : V.Y > 0 : V.X > 0;
-			});
-
-		for (const int32 PointIndex : InSorted) { Graph->GetOrCreateNode(InPoints[PointIndex], PointIO->IOIndex, PointIndex); }
-
-		/*
-		if (Context->bPreserveOrder)
+		// Vtx are final at this point; each subgraph only touches its own edge IO from here on.
+		for (PCGExGraph::FSubGraph* SubGraph : Builder->Graph->SubGraphs)
 		{
-			FusedPoints.Sort([&](const PCGExFuse::FFusedPoint& A, const PCGExFuse::FFusedPoint& B) { return A.Index > B.Index; });
+			Manager->Start<FWriteSubGraphEdges>(SubGraphIndex++, PointIO, Builder->Graph, SubGraph, MetadataSettings);
 		}
-		*/
+
 		return true;
 	}
 
@@ -167,7 +167,7 @@ bool FPCGExFindClusterChainsTask::ExecuteTask()
 		Context->IsEdgeFixtureGetter->IsUsable(Cluster.Edges.Num()))
 	{
 		Context->IsEdgeFixtureGetter->Grab(*Context->CurrentEdges);
-		const TArray<bool> FixedEdges = Context->IsEdgeFixtureGetter->Values;
+		const TArrayView<const bool> FixedEdges = Context->IsEdgeFixtureGetter->Values;
 		for (int i = 0; i < FixedEdges.Num(); i++)
 		{
 			if (bool bFix = FixedEdges[i]; !bFix || (bFix && Settings->bInvertEdgeFixAttribute)) { continue; }
@@ -30,6 +30,13 @@ double UPCGExHeuristicDirection::GetGlobalScore(
 	return FMath::Max(0, ScoreCurveObj->GetFloatValue(PCGExMath::Remap(Dot, -1, 1, OutMin, OutMax))) * ReferenceWeight;
 }
 
+void UPCGExHeuristicDirection::ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const
+{
+	GetCurveValueRange(ScoreCurveObj, OutMin, OutMax);
+	OutMin *= ReferenceWeight;
+	OutMax *= ReferenceWeight;
+}
+
 double UPCGExHeuristicDirection::GetEdgeScore(
 	const PCGExCluster::FNode& From,
 	const PCGExCluster::FNode& To,
@@ -41,6 +48,8 @@ double UPCGExHeuristicDirection::GetEdgeScore(
 	return FMath::Max(0, ScoreCurveObj->GetFloatValue(PCGExMath::Remap(Dot, -1, 1, OutMin, OutMax))) * ReferenceWeight;
 }
 
+bool UPCGExHeuristicDirection::HasGoalDependentEdgeScore() const { return true; }
+
 void UPCGExHeuristicDirection::ApplyOverrides()
 {
 	Super::ApplyOverrides();
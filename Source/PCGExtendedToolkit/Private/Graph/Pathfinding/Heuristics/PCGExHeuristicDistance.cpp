@@ -17,3 +17,10 @@ double UPCGExHeuristicDistance::GetGlobalScore(
 {
 	return (FVector::DistSquared(From.Position, Goal.Position) / MaxDistSquared) * ReferenceWeight;
 }
+
+void UPCGExHeuristicDistance::ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const
+{
+	// Any two nodes are at most the bounds' diagonal apart
+	OutMin = 0;
+	OutMax = ReferenceWeight;
+}
@@ -10,6 +10,8 @@ void UPCGExHeuristicOperation::PrepareForData(PCGExCluster::FCluster* InCluster)
 
 	if (!ScoreCurve || ScoreCurve.IsNull()) { ScoreCurveObj = TSoftObjectPtr<UCurveFloat>(PCGEx::WeightDistributionLinear).LoadSynchronous(); }
 	else { ScoreCurveObj = ScoreCurve.LoadSynchronous(); }
+
+	ComputeGlobalScoreBounds(MinGlobalScore, MaxGlobalScore);
 }
 
 double UPCGExHeuristicOperation::GetGlobalScore(
@@ -30,6 +32,22 @@ double UPCGExHeuristicOperation::GetEdgeScore(
 	return 1;
 }
 
+bool UPCGExHeuristicOperation::HasGoalDependentEdgeScore() const { return false; }
+
+void UPCGExHeuristicOperation::ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const
+{
+	OutMin = OutMax = 0;
+}
+
+void UPCGExHeuristicOperation::GetCurveValueRange(const UCurveFloat* InCurve, double& OutMin, double& OutMax)
+{
+	float CurveMin = 0;
+	float CurveMax = 1;
+	if (InCurve) { InCurve->GetValueRange(CurveMin, CurveMax); }
+	OutMin = FMath::Max(0, CurveMin);
+	OutMax = FMath::Max(0, CurveMax);
+}
+
 void UPCGExHeuristicOperation::Cleanup()
 {
 	Cluster = nullptr;
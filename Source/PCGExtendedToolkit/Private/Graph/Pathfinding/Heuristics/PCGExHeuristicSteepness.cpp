@@ -28,6 +28,17 @@ double UPCGExHeuristicSteepness::GetGlobalScore(
 	return (SampledDot + Super) * 0.5;
 }
 
+void UPCGExHeuristicSteepness::ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const
+{
+	double SuperMin;
+	double SuperMax;
+	Super::ComputeGlobalScoreBounds(SuperMin, SuperMax);
+
+	GetCurveValueRange(SteepnessScoreCurveObj, OutMin, OutMax);
+	OutMin = (OutMin * ReferenceWeight + SuperMin) * 0.5;
+	OutMax = (OutMax * ReferenceWeight + SuperMax) * 0.5;
+}
+
 double UPCGExHeuristicSteepness::GetEdgeScore(
 	const PCGExCluster::FNode& From,
 	const PCGExCluster::FNode& To,
@@ -40,6 +40,29 @@ FPCGExPathfindingEdgesContext::~FPCGExPathfindingEdgesContext()
 
 	PCGEX_DELETE(GlobalExtraWeights)
 	PCGEX_DELETE_TARRAY(PathBuffer)
+	SeedQueryGroups.Empty();
+}
+
+void FPCGExPathfindingEdgesContext::WritePath(const PCGExPathfinding::FPathQuery* Query, const TArray<int32>& Path) const
+{
+	const FPCGPoint& Seed = SeedsPoints->GetInPoint(Query->SeedIndex);
+	const FPCGPoint& Goal = GoalsPoints->GetInPoint(Query->GoalIndex);
+
+	PCGExData::FPointIO& PathPoints = OutputPaths->Emplace_GetRef(GetCurrentIn(), PCGExData::EInit::NewOutput);
+	UPCGPointData* OutData = PathPoints.GetOut();
+
+	PCGExGraph::CleanupVtxData(&PathPoints);
+
+	TArray<FPCGPoint>& MutablePoints = OutData->GetMutablePoints();
+	const TArray<FPCGPoint>& InPoints = GetCurrentIn()->GetPoints();
+
+	MutablePoints.Reserve(Path.Num() + 2);
+
+	if (bAddSeedToPath) { MutablePoints.Add_GetRef(Seed).MetadataEntry = PCGInvalidEntryKey; }
+	for (const int32 VtxIndex : Path) { MutablePoints.Add(InPoints[CurrentCluster->Nodes[VtxIndex].PointIndex]); }
+	if (bAddGoalToPath) { MutablePoints.Add_GetRef(Goal).MetadataEntry = PCGInvalidEntryKey; }
+
+	PathPoints.Flatten();
 }
 
 
@@ -77,6 +100,7 @@ bool FPCGExPathfindingEdgesElement::ExecuteInternal(FPCGContext* InContext) cons
 			else
 			{
 				PCGEX_DELETE_TARRAY(Context->PathBuffer)
+				Context->SeedQueryGroups.Empty();
 
 				Context->GoalPicker->PrepareForData(*Context->SeedsPoints, *Context->GoalsPoints);
 				Context->SetState(PCGExMT::State_ProcessingPoints);
@@ -86,10 +110,20 @@ bool FPCGExPathfindingEdgesElement::ExecuteInternal(FPCGContext* InContext) cons
 
 	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
+		TMap<int32, int32> SeedGroupIndices;
+
 		PCGExPathfinding::ProcessGoals(
 			Context->SeedsPoints, Context->GoalPicker,
 			[&](const int32 SeedIndex, const int32 GoalIndex)
 			{
+				const int32* GroupIndex = SeedGroupIndices.Find(SeedIndex);
+				if (!GroupIndex)
+				{
+					GroupIndex = &SeedGroupIndices.Add(SeedIndex, Context->SeedQueryGroups.Num());
+					Context->SeedQueryGroups.Emplace();
+				}
+				Context->SeedQueryGroups[*GroupIndex].Add(Context->PathBuffer.Num());
+
 				Context->PathBuffer.Add(
 					new PCGExPathfinding::FPathQuery(
 						SeedIndex, Context->SeedsPoints->GetInPoint(SeedIndex).Transform.GetLocation(),
@@ -149,9 +183,9 @@ bool FPCGExPathfindingEdgesElement::ExecuteInternal(FPCGContext* InContext) cons
 		}
 		else
 		{
-			for (int i = 0; i < Context->PathBuffer.Num(); i++)
+			for (int i = 0; i < Context->SeedQueryGroups.Num(); i++)
 			{
-				Context->GetAsyncManager()->Start<FSampleClusterPathTask>(i, Context->CurrentIO, Context->PathBuffer[i]);
+				Context->GetAsyncManager()->Start<FSampleClusterPathGroupTask>(i, Context->CurrentIO);
 			}
 
 			Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
@@ -201,11 +235,6 @@ bool FSampleClusterPathTask::ExecuteTask()
 {
 	const FPCGExPathfindingEdgesContext* Context = Manager->GetContext<FPCGExPathfindingEdgesContext>();
 
-	const FPCGPoint& Seed = Context->SeedsPoints->GetInPoint(Query->SeedIndex);
-	const FPCGPoint& Goal = Context->GoalsPoints->GetInPoint(Query->GoalIndex);
-
-	const PCGExCluster::FCluster* Cluster = Context->CurrentCluster;
-
 	TArray<int32> Path;
 
 	//Note: Can silently fail
@@ -217,23 +246,35 @@ bool FSampleClusterPathTask::ExecuteTask()
 		return false;
 	}
 
-	PCGExData::FPointIO& PathPoints = Context->OutputPaths->Emplace_GetRef(Context->GetCurrentIn(), PCGExData::EInit::NewOutput);
-	UPCGPointData* OutData = PathPoints.GetOut();
+	Context->WritePath(Query, Path);
 
-	PCGExGraph::CleanupVtxData(&PathPoints);
+	return true;
+}
 
-	TArray<FPCGPoint>& MutablePoints = OutData->GetMutablePoints();
-	const TArray<FPCGPoint>& InPoints = Context->GetCurrentIn()->GetPoints();
+bool FSampleClusterPathGroupTask::ExecuteTask()
+{
+	const FPCGExPathfindingEdgesContext* Context = Manager->GetContext<FPCGExPathfindingEdgesContext>();
+	const TArray<int32>& QueryIndices = Context->SeedQueryGroups[TaskIndex];
 
-	MutablePoints.Reserve(Path.Num() + 2);
+	const FVector SeedPosition = Context->PathBuffer[QueryIndices[0]]->SeedPosition;
 
-	if (Context->bAddSeedToPath) { MutablePoints.Add_GetRef(Seed).MetadataEntry = PCGInvalidEntryKey; }
-	for (const int32 VtxIndex : Path) { MutablePoints.Add(InPoints[Cluster->Nodes[VtxIndex].PointIndex]); }
-	if (Context->bAddGoalToPath) { MutablePoints.Add_GetRef(Goal).MetadataEntry = PCGInvalidEntryKey; }
+	TArray<FVector> GoalPositions;
+	GoalPositions.SetNumUninitialized(QueryIndices.Num());
+	for (int i = 0; i < QueryIndices.Num(); i++) { GoalPositions[i] = Context->PathBuffer[QueryIndices[i]]->GoalPosition; }
 
-	PathPoints.Flatten();
+	TArray<TArray<int32>> Paths;
+	Context->SearchAlgorithm->FindPaths(SeedPosition, GoalPositions, Context->Heuristics, Context->HeuristicsModifiers, Paths);
 
-	return true;
+	bool bAnySuccess = false;
+	for (int i = 0; i < QueryIndices.Num(); i++)
+	{
+		//Note: Can silently fail
+		if (Paths[i].IsEmpty()) { continue; }
+		Context->WritePath(Context->PathBuffer[QueryIndices[i]], Paths[i]);
+		bAnySuccess = true;
+	}
+
+	return bAnySuccess;
 }
 
 #undef LOCTEXT_NAMESPACE
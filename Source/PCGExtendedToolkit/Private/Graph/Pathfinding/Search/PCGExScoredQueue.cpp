@@ -1,40 +1,115 @@
-﻿#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
 
-PCGExSearch::TScoredQueue::TScoredQueue(const int32 Size, const int32& Item, const double Score)
-{
-	Scores.SetNum(Size);
-	Enqueue(Item, Score);
-}
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
 
-PCGExSearch::TScoredQueue::~TScoredQueue()
+namespace PCGExSearch
 {
-	std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> EmptyQueue;
-	std::swap(InternalQueue, EmptyQueue);
-	Scores.Empty();
-}
+	TScoredQueue::TScoredQueue(const int32 Size)
+	{
+		Reset(Size);
+	}
 
-void PCGExSearch::TScoredQueue::Enqueue(const int32& Id, const double Score)
-{
-	Scores[Id] = Score;
-	InternalQueue.push(FScoredNode(Id, Score));
-}
+	TScoredQueue::TScoredQueue(const int32 Size, const int32& Item, const double Score)
+	{
+		Reset(Size);
+		Enqueue(Item, Score);
+	}
 
-bool PCGExSearch::TScoredQueue::Dequeue(int32& Item, double& OutScore)
-{
-	//TRACE_CPUPROFILER_EVENT_SCOPE(ScoredQueue::Dequeue);
+	TScoredQueue::~TScoredQueue()
+	{
+		Heap.Empty();
+		Positions.Empty();
+		Scores.Empty();
+	}
+
+	void TScoredQueue::Reset(const int32 Size)
+	{
+		for (const FScoredNode& Node : Heap) { Positions[Node.Id] = -1; }
+		Heap.Reset();
+		NextSequence = 0;
+
+		if (const int32 PrevSize = Positions.Num();
+			PrevSize < Size)
+		{
+			Positions.SetNumUninitialized(Size);
+			for (int i = PrevSize; i < Size; i++) { Positions[i] = -1; }
+			Scores.SetNumUninitialized(Size);
+		}
+	}
+
+	void TScoredQueue::Enqueue(const int32& Id, const double Score)
+	{
+		Scores[Id] = Score;
 
-	while (!InternalQueue.empty())
+		if (const int32 Index = Positions[Id];
+			Index != -1)
+		{
+			const FScoredNode Updated = FScoredNode{Id, Score, NextSequence++};
+			const bool bMovesUp = IsLess(Updated, Heap[Index]);
+			Heap[Index] = Updated;
+			if (bMovesUp) { SiftUp(Index); }
+			else { SiftDown(Index); }
+			return;
+		}
+
+		const int32 Index = Heap.Num();
+		Heap.Add(FScoredNode{Id, Score, NextSequence++});
+		Positions[Id] = Index;
+		SiftUp(Index);
+	}
+
+	bool TScoredQueue::Dequeue(int32& Item, double& OutScore)
 	{
-		const FScoredNode TopNode = InternalQueue.top();
-		InternalQueue.pop();
+		if (Heap.IsEmpty()) { return false; }
+
+		const FScoredNode Top = Heap[0];
+		Positions[Top.Id] = -1;
+
+		const FScoredNode Last = Heap.Pop(false);
+		if (!Heap.IsEmpty())
+		{
+			Place(0, Last);
+			SiftDown(0);
+		}
+
+		Item = Top.Id;
+		OutScore = Top.Score;
+		return true;
+	}
 
-		if (TopNode.Score == Scores[TopNode.Id])
+	void TScoredQueue::SiftUp(int32 Index)
+	{
+		const FScoredNode Node = Heap[Index];
+		while (Index > 0)
 		{
-			Item = TopNode.Id;
-			OutScore = TopNode.Score;
-			return true;
+			const int32 ParentIndex = (Index - 1) >> 2;
+			if (!IsLess(Node, Heap[ParentIndex])) { break; }
+			Place(Index, Heap[ParentIndex]);
+			Index = ParentIndex;
 		}
+		Place(Index, Node);
 	}
 
-	return false;
+	void TScoredQueue::SiftDown(int32 Index)
+	{
+		const int32 Count = Heap.Num();
+		const FScoredNode Node = Heap[Index];
+
+		while (true)
+		{
+			const int32 FirstChild = (Index << 2) + 1;
+			if (FirstChild >= Count) { break; }
+
+			int32 BestChild = FirstChild;
+			const int32 LastChild = FMath::Min(FirstChild + 4, Count);
+			for (int32 Child = FirstChild + 1; Child < LastChild; Child++) { if (IsLess(Heap[Child], Heap[BestChild])) { BestChild = Child; } }
+
+			if (!IsLess(Heap[BestChild], Node)) { break; }
+			Place(Index, Heap[BestChild]);
+			Index = BestChild;
+		}
+
+		Place(Index, Node);
+	}
 }
@@ -7,7 +7,6 @@
 #include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/PCGExPathfinding.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicOperation.h"
-#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
 
 bool UPCGExSearchAStar::FindPath(
 	const FVector& SeedPosition,
@@ -22,75 +21,52 @@ bool UPCGExSearchAStar::FindPath(
 
 	if (SeedNode.NodeIndex == GoalNode.NodeIndex) { return false; }
 
-	const int32 NumNodes = Cluster->Nodes.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
 
-	// Basic A* implementation TODO:Optimize
-
-	TSet<int32> Visited;
-	TArray<int32> Previous;
-	TArray<double> GScore;
-
-	GScore.SetNum(NumNodes);
-	Previous.SetNum(NumNodes);
-	for (int i = 0; i < NumNodes; i++)
-	{
-		GScore[i] = -1;
-		Previous[i] = -1;
-	}
-
-	double MinGScore = TNumericLimits<double>::Max();
-	double MaxGScore = TNumericLimits<double>::Min();
-
-	for (int i = 0; i < Cluster->Nodes.Num(); i++)
-	{
-		const double GS = Heuristics->GetGlobalScore(Cluster->Nodes[i], SeedNode, GoalNode);
-		MinGScore = FMath::Min(MinGScore, GS);
-		MaxGScore = FMath::Max(MaxGScore, GS);
-	}
+	// Global scores are normalized against cluster-wide bounds computed once in Heuristics->PrepareForData,
+	// and per-node state lives in a reused workspace, so a query only costs what it actually visits.
+	PCGExSearch::FSearchWorkspace* Workspace = AcquireWorkspace();
 
-	PCGExSearch::TScoredQueue* ScoredQueue = new PCGExSearch::TScoredQueue(
-		NumNodes, SeedNode.NodeIndex, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
-	GScore[SeedNode.NodeIndex] = 0;
+	Workspace->SetGScore(SeedNode.NodeIndex, 0, -1);
+	Workspace->Enqueue(SeedNode.NodeIndex, Heuristics->GetNormalizedGlobalScore(SeedNode, SeedNode, GoalNode) * Heuristics->ReferenceWeight);
 
 	bool bSuccess = false;
 
 	int32 CurrentNodeIndex;
 	double CurrentFScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentFScore))
+	while (Workspace->Dequeue(CurrentNodeIndex, CurrentFScore))
 	{
 		if (CurrentNodeIndex == GoalNode.NodeIndex) { break; } // Exit early
 
-		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const double CurrentGScore = Workspace->GetGScore(CurrentNodeIndex);
 		const PCGExCluster::FNode& Current = Cluster->Nodes[CurrentNodeIndex];
-		Visited.Add(CurrentNodeIndex);
+		Workspace->MarkVisited(CurrentNodeIndex);
 
-		for (const int32 AdjacentIndex : Current.AdjacentNodes)
+		for (int i = 0; i < Current.AdjacentNodes.Num(); i++)
 		{
-			if (Visited.Contains(AdjacentIndex)) { continue; }
+			const int32 AdjacentIndex = Current.AdjacentNodes[i];
+			if (Workspace->IsVisited(AdjacentIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = Cluster->Nodes[AdjacentIndex];
-			const PCGExGraph::FIndexedEdge& Edge = Cluster->GetEdgeFromNodeIndices(CurrentNodeIndex, AdjacentIndex);
+			const PCGExGraph::FIndexedEdge& Edge = Cluster->Edges[Current.Edges[i]];
 
 			const double ExtraWeight = +ExtraWeights ? ExtraWeights->GetExtraWeight(CurrentNodeIndex, Edge.EdgeIndex) : 0;
 			const double ScoreMod = Modifiers->GetScore(AdjacentNode.PointIndex, Edge.PointIndex);
 			const double TentativeGScore = CurrentGScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode) + ScoreMod;
 
-			const double PreviousGScore = GScore[AdjacentIndex];
+			const double PreviousGScore = Workspace->GetGScore(AdjacentIndex);
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
-			Previous[AdjacentIndex] = CurrentNodeIndex;
-			GScore[AdjacentIndex] = TentativeGScore;
+			Workspace->SetGScore(AdjacentIndex, TentativeGScore, CurrentNodeIndex);
 
-			const double GS = PCGExMath::Remap(Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode), MinGScore, MaxGScore, 0, 1);
+			const double GS = Heuristics->GetNormalizedGlobalScore(AdjacentNode, SeedNode, GoalNode);
 			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight;
 
-			ScoredQueue->Enqueue(AdjacentIndex, FScore);
+			Workspace->Enqueue(AdjacentIndex, FScore);
 		}
 	}
 
-	if (int32 PathIndex = Previous[GoalNode.NodeIndex];
+	if (int32 PathIndex = Workspace->GetPrevious(GoalNode.NodeIndex);
 		PathIndex != -1)
 	{
 		PathIndex = GoalNode.NodeIndex;
@@ -106,7 +82,7 @@ bool UPCGExSearchAStar::FindPath(
 				const int32 CurrentIndex = PathIndex;
 				ExtraWeights->AddPointWeight(CurrentIndex, ExtraNodeWeight);
 				Path.Add(CurrentIndex);
-				PathIndex = Previous[PathIndex];
+				PathIndex = Workspace->GetPrevious(PathIndex);
 
 				if (PathIndex != -1)
 				{
@@ -120,16 +96,14 @@ bool UPCGExSearchAStar::FindPath(
 			while (PathIndex != -1)
 			{
 				Path.Add(PathIndex);
-				PathIndex = Previous[PathIndex];
+				PathIndex = Workspace->GetPrevious(PathIndex);
 			}
 		}
 		Algo::Reverse(Path);
 		OutPath.Append(Path);
 	}
 
-	PCGEX_DELETE(ScoredQueue)
-	Previous.Empty();
-	GScore.Empty();
+	ReleaseWorkspace(Workspace);
 
 	return bSuccess;
 }
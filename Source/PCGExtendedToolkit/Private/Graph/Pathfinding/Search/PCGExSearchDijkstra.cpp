@@ -7,7 +7,6 @@
 #include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/PCGExPathfinding.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicOperation.h"
-#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
 
 bool UPCGExSearchDijkstra::FindPath(
 	const FVector& SeedPosition,
@@ -22,53 +21,41 @@ bool UPCGExSearchDijkstra::FindPath(
 
 	if (SeedNode.NodeIndex == GoalNode.NodeIndex) { return false; }
 
-	const int32 NumNodes = Cluster->Nodes.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
 
+	// Basic Dijkstra implementation, on top of a reused workspace & decrease-key queue
 
-	// Basic Dijkstra implementation
-
-	TSet<int32> Visited;
-	TArray<int32> Previous;
+	PCGExSearch::FSearchWorkspace* Workspace = AcquireWorkspace();
 
-	PCGExSearch::TScoredQueue* ScoredQueue = new PCGExSearch::TScoredQueue(
-		NumNodes, SeedNode.NodeIndex, 0);
-
-	Previous.SetNum(NumNodes);
-	for (int i = 0; i < NumNodes; i++)
-	{
-		ScoredQueue->Scores[i] = -1;
-		Previous[i] = -1;
-	}
-
-	ScoredQueue->Scores[SeedNode.NodeIndex] = 0;
+	Workspace->SetGScore(SeedNode.NodeIndex, 0, -1);
+	Workspace->Enqueue(SeedNode.NodeIndex, 0);
 
 	int32 CurrentNodeIndex;
 	double CurrentScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	while (Workspace->Dequeue(CurrentNodeIndex, CurrentScore))
 	{
 		if (CurrentNodeIndex == GoalNode.NodeIndex) { break; } // Exit early
 
 		const PCGExCluster::FNode& Current = Cluster->Nodes[CurrentNodeIndex];
-		Visited.Add(CurrentNodeIndex);
+		Workspace->MarkVisited(CurrentNodeIndex);
 
-		for (const int32 AdjacentIndex : Current.AdjacentNodes)
+		for (int i = 0; i < Current.AdjacentNodes.Num(); i++)
 		{
-			if (Visited.Contains(AdjacentIndex)) { continue; }
+			const int32 AdjacentIndex = Current.AdjacentNodes[i];
+			if (Workspace->IsVisited(AdjacentIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = Cluster->Nodes[AdjacentIndex];
-			const PCGExGraph::FIndexedEdge& Edge = Cluster->GetEdgeFromNodeIndices(CurrentNodeIndex, AdjacentIndex);
+			const PCGExGraph::FIndexedEdge& Edge = Cluster->Edges[Current.Edges[i]];
 
 			const double ExtraWeight = +ExtraWeights ? ExtraWeights->GetExtraWeight(CurrentNodeIndex, Edge.EdgeIndex) : 0;
 			const double ScoreMod = Modifiers->GetScore(AdjacentNode.PointIndex, Edge.PointIndex) + ExtraWeight;
 			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode) + ScoreMod;
 
-			const double PreviousScore = ScoredQueue->Scores[AdjacentIndex];
+			const double PreviousScore = Workspace->GetGScore(AdjacentIndex);
 			if (PreviousScore != -1 && AltScore > PreviousScore) { continue; }
 
-			ScoredQueue->Enqueue(AdjacentIndex, AltScore);
-			Previous[AdjacentIndex] = CurrentNodeIndex;
+			Workspace->SetGScore(AdjacentIndex, AltScore, CurrentNodeIndex);
+			Workspace->Enqueue(AdjacentIndex, AltScore);
 		}
 	}
 
@@ -84,7 +71,7 @@ bool UPCGExSearchDijkstra::FindPath(
 			const int32 CurrentIndex = PathIndex;
 			ExtraWeights->AddPointWeight(CurrentIndex, ExtraNodeWeight);
 			Path.Add(CurrentIndex);
-			PathIndex = Previous[PathIndex];
+			PathIndex = Workspace->GetPrevious(PathIndex);
 
 			if (PathIndex != -1)
 			{
@@ -98,7 +85,7 @@ bool UPCGExSearchDijkstra::FindPath(
 		while (PathIndex != -1)
 		{
 			Path.Add(PathIndex);
-			PathIndex = Previous[PathIndex];
+			PathIndex = Workspace->GetPrevious(PathIndex);
 		}
 	}
 
@@ -106,9 +93,97 @@ bool UPCGExSearchDijkstra::FindPath(
 	Algo::Reverse(Path);
 	OutPath.Append(Path);
 
-	Visited.Empty();
-	Previous.Empty();
-	PCGEX_DELETE(ScoredQueue)
+	ReleaseWorkspace(Workspace);
 
 	return true;
 }
+
+void UPCGExSearchDijkstra::FindPaths(
+	const FVector& SeedPosition,
+	const TArray<FVector>& GoalPositions,
+	const UPCGExHeuristicOperation* Heuristics,
+	const FPCGExHeuristicModifiersSettings* Modifiers,
+	TArray<TArray<int32>>& OutPaths)
+{
+	// A shared tree is only valid if edge scores don't change from one goal to another
+	if (Heuristics->HasGoalDependentEdgeScore())
+	{
+		Super::FindPaths(SeedPosition, GoalPositions, Heuristics, Modifiers, OutPaths);
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPaths);
+
+	const int32 NumGoals = GoalPositions.Num();
+	OutPaths.SetNum(NumGoals);
+
+	const PCGExCluster::FNode& SeedNode = Cluster->Nodes[Cluster->FindClosestNode(SeedPosition, SearchMode, 1)];
+
+	TArray<int32> GoalNodes;
+	TSet<int32> PendingGoals;
+	GoalNodes.SetNumUninitialized(NumGoals);
+	PendingGoals.Reserve(NumGoals);
+
+	for (int i = 0; i < NumGoals; i++)
+	{
+		OutPaths[i].Reset();
+		GoalNodes[i] = Cluster->FindClosestNode(GoalPositions[i], SearchMode, 1);
+		if (GoalNodes[i] != SeedNode.NodeIndex) { PendingGoals.Add(GoalNodes[i]); }
+	}
+
+	if (PendingGoals.IsEmpty()) { return; }
+
+	// Goal is only forwarded for API consistency; edge scores are goal-independent here
+	const PCGExCluster::FNode& AnyGoalNode = Cluster->Nodes[GoalNodes[0]];
+
+	// Single-source Dijkstra, grown until every goal is settled
+	PCGExSearch::FSearchWorkspace* Workspace = AcquireWorkspace();
+
+	Workspace->SetGScore(SeedNode.NodeIndex, 0, -1);
+	Workspace->Enqueue(SeedNode.NodeIndex, 0);
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (Workspace->Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		if (PendingGoals.Remove(CurrentNodeIndex) && PendingGoals.IsEmpty()) { break; } // Exit early
+
+		const PCGExCluster::FNode& Current = Cluster->Nodes[CurrentNodeIndex];
+		Workspace->MarkVisited(CurrentNodeIndex);
+
+		for (int i = 0; i < Current.AdjacentNodes.Num(); i++)
+		{
+			const int32 AdjacentIndex = Current.AdjacentNodes[i];
+			if (Workspace->IsVisited(AdjacentIndex)) { continue; }
+
+			const PCGExCluster::FNode& AdjacentNode = Cluster->Nodes[AdjacentIndex];
+			const PCGExGraph::FIndexedEdge& Edge = Cluster->Edges[Current.Edges[i]];
+
+			const double ScoreMod = Modifiers->GetScore(AdjacentNode.PointIndex, Edge.PointIndex);
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, AnyGoalNode) + ScoreMod;
+
+			const double PreviousScore = Workspace->GetGScore(AdjacentIndex);
+			if (PreviousScore != -1 && AltScore > PreviousScore) { continue; }
+
+			Workspace->SetGScore(AdjacentIndex, AltScore, CurrentNodeIndex);
+			Workspace->Enqueue(AdjacentIndex, AltScore);
+		}
+	}
+
+	// Extract every path from the shared predecessor tree
+	for (int i = 0; i < NumGoals; i++)
+	{
+		if (GoalNodes[i] == SeedNode.NodeIndex) { continue; }
+
+		TArray<int32>& Path = OutPaths[i];
+		int32 PathIndex = GoalNodes[i];
+		while (PathIndex != -1)
+		{
+			Path.Add(PathIndex);
+			PathIndex = Workspace->GetPrevious(PathIndex);
+		}
+		Algo::Reverse(Path);
+	}
+
+	ReleaseWorkspace(Workspace);
+}
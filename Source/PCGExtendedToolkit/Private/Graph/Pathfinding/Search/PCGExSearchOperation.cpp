@@ -4,6 +4,30 @@
 
 #include "Graph/Pathfinding/Search/PCGExSearchOperation.h"
 
+namespace PCGExSearch
+{
+	void FSearchWorkspace::Prepare(const int32 NumNodes)
+	{
+		if (ScoreStamps.Num() < NumNodes)
+		{
+			ScoreStamps.SetNumZeroed(NumNodes);
+			VisitedStamps.SetNumZeroed(NumNodes);
+			GScore.SetNumUninitialized(NumNodes);
+			Previous.SetNumUninitialized(NumNodes);
+		}
+
+		if (++Generation == 0)
+		{
+			// Stamps wrapped around, stale entries could alias the new generation
+			FMemory::Memzero(ScoreStamps.GetData(), ScoreStamps.Num() * sizeof(uint32));
+			FMemory::Memzero(VisitedStamps.GetData(), VisitedStamps.Num() * sizeof(uint32));
+			Generation = 1;
+		}
+
+		OpenQueue.Reset(NumNodes);
+	}
+}
+
 bool UPCGExSearchOperation::GetRequiresProjection() { return false; }
 
 void UPCGExSearchOperation::PrepareForCluster(PCGExCluster::FCluster* InCluster, PCGExCluster::FClusterProjection* InProjection)
@@ -22,3 +46,52 @@ bool UPCGExSearchOperation::FindPath(
 {
 	return false;
 }
+
+void UPCGExSearchOperation::FindPaths(
+	const FVector& SeedPosition,
+	const TArray<FVector>& GoalPositions,
+	const UPCGExHeuristicOperation* Heuristics,
+	const FPCGExHeuristicModifiersSettings* Modifiers,
+	TArray<TArray<int32>>& OutPaths)
+{
+	OutPaths.SetNum(GoalPositions.Num());
+	for (int i = 0; i < GoalPositions.Num(); i++)
+	{
+		OutPaths[i].Reset();
+		if (!FindPath(SeedPosition, GoalPositions[i], Heuristics, Modifiers, OutPaths[i], nullptr)) { OutPaths[i].Reset(); }
+	}
+}
+
+void UPCGExSearchOperation::Cleanup()
+{
+	{
+		FWriteScopeLock WriteLock(WorkspaceLock);
+		PCGEX_DELETE_TARRAY(Workspaces)
+	}
+
+	Cluster = nullptr;
+	Projection = nullptr;
+
+	Super::Cleanup();
+}
+
+PCGExSearch::FSearchWorkspace* UPCGExSearchOperation::AcquireWorkspace()
+{
+	PCGExSearch::FSearchWorkspace* Workspace = nullptr;
+
+	{
+		FWriteScopeLock WriteLock(WorkspaceLock);
+		if (!Workspaces.IsEmpty()) { Workspace = Workspaces.Pop(false); }
+	}
+
+	if (!Workspace) { Workspace = new PCGExSearch::FSearchWorkspace(); }
+	Workspace->Prepare(Cluster->Nodes.Num());
+
+	return Workspace;
+}
+
+void UPCGExSearchOperation::ReleaseWorkspace(PCGExSearch::FSearchWorkspace* InWorkspace)
+{
+	FWriteScopeLock WriteLock(WorkspaceLock);
+	Workspaces.Add(InWorkspace);
+}
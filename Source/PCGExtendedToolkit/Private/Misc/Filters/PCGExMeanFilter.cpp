@@ -89,9 +89,10 @@ void PCGExPointsFilter::TMeanHandler::PrepareForTesting(PCGExData::FPointIO* Poi
 		double RelativeMinEdgeLength = TNumericLimits<double>::Max();
 		double RelativeMaxEdgeLength = TNumericLimits<double>::Min();
 		SumValue = 0;
+		TArray<double>& TargetValues = Target->GetMutableValues();
 		for (int i = 0; i < NumPoints; i++)
 		{
-			const double Normalized = (Target->Values[i] /= Target->Max);
+			const double Normalized = (TargetValues[i] /= Target->Max);
 			RelativeMinEdgeLength = FMath::Min(Normalized, RelativeMinEdgeLength);
 			RelativeMaxEdgeLength = FMath::Max(Normalized, RelativeMaxEdgeLength);
 			SumValue += Normalized;
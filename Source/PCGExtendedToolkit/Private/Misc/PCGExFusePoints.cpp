@@ -13,8 +13,6 @@ PCGExData::EInit UPCGExFusePointsSettings::GetMainOutputInitMode() const { retur
 FPCGExFusePointsContext::~FPCGExFusePointsContext()
 {
 	PCGEX_TERMINATE_ASYNC
-
-	PCGEX_DELETE(CompoundGraph)
 }
 
 UPCGExFusePointsSettings::UPCGExFusePointsSettings(const FObjectInitializer& ObjectInitializer)
@@ -60,70 +58,71 @@ bool FPCGExFusePointsElement::ExecuteInternal(FPCGContext* InContext) const
 
 	if (Context->IsState(PCGExMT::State_ReadyForNextPoints))
 	{
-		PCGEX_DELETE(Context->CompoundGraph)
-
-		if (!Context->AdvancePointsIO()) { Context->Done(); }
-		else
-		{
-			// Fuse points into compound graph
-			Context->CompoundGraph = new PCGExGraph::FCompoundGraph(Context->PointPointIntersectionSettings.FuseSettings, Context->CurrentIO->GetIn()->GetBounds().ExpandBy(10));
-			Context->GetAsyncManager()->Start<PCGExGraphTask::FCompoundGraphInsertPoints>(
-				Context->CurrentIO->IOIndex, Context->CurrentIO, Context->CompoundGraph);
-
-			Context->SetAsyncState(PCGExMT::State_ProcessingPoints);
-		}
+		// Inputs are fused independently, so they can all be processed at once
+		Context->StartBatchProcessingPoints<PCGExFusePoints::FProcessor>([](const PCGExData::FPointIO&) { return true; });
+		Context->SetAsyncState(PCGExMT::State_ProcessingPoints);
 	}
 
 	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
-		PCGEX_WAIT_ASYNC
-
-		// Build output points from compound graph
-		const int32 NumCompoundNodes = Context->CompoundGraph->Nodes.Num();
-		TArray<FPCGPoint>& MutablePoints = Context->CurrentIO->GetOut()->GetMutablePoints();
-		if (MutablePoints.Num() != NumCompoundNodes) { MutablePoints.SetNum(NumCompoundNodes); }
+		if (!Context->ProcessPointsBatch()) { return false; }
+		Context->Done();
+	}
 
-		auto ProcessNode = [&](const int32 Index)
-		{
-			PCGExGraph::FCompoundNode* CompoundNode = Context->CompoundGraph->Nodes[Index];
-			MutablePoints[Index].Transform.SetLocation(CompoundNode->UpdateCenter(Context->CompoundGraph->PointsCompounds, Context->MainPoints));
-		};
+	if (Context->IsDone())
+	{
+		Context->OutputPoints();
+	}
 
-		if (!Context->Process(ProcessNode, NumCompoundNodes)) { return false; }
+	return Context->IsDone();
+}
 
-		Context->SetAsyncState(PCGExData::State_MergingData);
+namespace PCGExFusePoints
+{
+	FProcessor::~FProcessor()
+	{
+		PCGEX_DELETE(CompoundGraph)
 	}
 
-	if (Context->IsState(PCGExData::State_MergingData))
+	bool FProcessor::Process(FPCGExAsyncManager* AsyncManager)
 	{
-		PCGEX_WAIT_ASYNC
+		const FPCGExFusePointsContext* Context = AsyncManager->GetContext<FPCGExFusePointsContext>();
+		PCGEX_SETTINGS(FusePoints)
 
-		const FPCGExPointPointIntersectionSettings* ISettings = const_cast<FPCGExPointPointIntersectionSettings*>(&Settings->PointPointIntersectionSettings);
+		PointIO->CreateInKeys();
 
-		// Blend attributes & properties
-		Context->GetAsyncManager()->Start<PCGExDataBlendingTask::FBlendCompoundedIO>(
-			Context->CurrentIO->IOIndex, Context->CurrentIO, Context->CurrentIO, const_cast<FPCGExBlendingSettings*>(&Settings->BlendingSettings),
-			Context->CompoundGraph->PointsCompounds, PCGExSettings::GetDistanceSettings(*ISettings), &Context->GraphMetadataSettings);
+		// Fuse
+		CompoundGraph = new PCGExGraph::FCompoundGraph(Context->PointPointIntersectionSettings.FuseSettings, PointIO->GetIn()->GetBounds().ExpandBy(10));
 
-		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
-	}
+		TArray<PCGExData::FPointIO*> Sources;
+		Sources.Add(PointIO);
+		CompoundGraph->InsertPoints(Sources);
 
-	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
-	{
-		PCGEX_WAIT_ASYNC
+		// Compute centers
+		const int32 NumCompoundNodes = CompoundGraph->Nodes.Num();
+		TArray<FPCGPoint>& MutablePoints = PointIO->GetOut()->GetMutablePoints();
+		MutablePoints.SetNum(NumCompoundNodes);
 
-		Context->CurrentIO->Flatten();
+		for (int i = 0; i < NumCompoundNodes; i++)
+		{
+			MutablePoints[i].Transform.SetLocation(CompoundGraph->Nodes[i]->UpdateCenter(CompoundGraph->PointsCompounds, Context->MainPoints));
+		}
 
-		Context->SetState(PCGExMT::State_ReadyForNextPoints);
-		return false;
+		// Blend attributes & properties, then write fuse meta so it isn't blended
+		PCGExDataBlendingTask::BlendCompoundedIO(
+			PointIO, PointIO, const_cast<FPCGExBlendingSettings*>(&Settings->BlendingSettings),
+			CompoundGraph->PointsCompounds, PCGExSettings::GetDistanceSettings(Settings->PointPointIntersectionSettings));
+
+		PCGExDataBlendingTask::WriteFuseMetadata(PointIO, &Context->GraphMetadataSettings, CompoundGraph->PointsCompounds);
+
+		return true;
 	}
 
-	if (Context->IsDone())
+	void FProcessor::CompleteWork()
 	{
-		Context->OutputPoints();
+		PointIO->Flatten();
+		PCGEX_DELETE(CompoundGraph)
 	}
-
-	return Context->IsDone();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -17,6 +17,7 @@ FPCGExLloydRelaxContext::~FPCGExLloydRelaxContext()
 	PCGEX_TERMINATE_ASYNC
 
 	PCGEX_DELETE(InfluenceGetter)
+	PCGEX_DELETE(Delaunay)
 
 	ActivePositions.Empty();
 }
@@ -30,6 +31,8 @@ bool FPCGExLloydRelaxElement::Boot(FPCGContext* InContext) const
 	Context->InfluenceGetter = new PCGEx::FLocalSingleFieldGetter();
 	Context->InfluenceGetter->Capture(Settings->InfluenceSettings.LocalInfluence);
 
+	Context->Delaunay = new PCGExGeo::TDelaunay3();
+
 	return true;
 }
 
@@ -59,9 +62,10 @@ bool FPCGExLloydRelaxElement::ExecuteInternal(FPCGContext* InContext) const
 			Context->CurrentIO->CreateInKeys();
 			Context->InfluenceGetter->Grab(*Context->CurrentIO);
 			PCGExGeo::PointsToPositions(Context->CurrentIO->GetIn()->GetPoints(), Context->ActivePositions);
+			Context->Delaunay->Clear();
 
 			Context->GetAsyncManager()->Start<FPCGExLloydRelax3Task>(
-				0, nullptr, &Context->ActivePositions,
+				0, nullptr, &Context->ActivePositions, Context->Delaunay,
 				&Settings->InfluenceSettings, Settings->Iterations, Context->InfluenceGetter);
 
 
@@ -107,45 +111,35 @@ bool FPCGExLloydRelax3Task::ExecuteTask()
 {
 	NumIterations--;
 
-	PCGExGeo::TDelaunay3* Delaunay = new PCGExGeo::TDelaunay3();
 	TArray<FVector>& Positions = *ActivePositions;
-
 	const TArrayView<FVector> View = MakeArrayView(Positions);
-	if (!Delaunay->Process(View)) { return false; }
 
-	const int32 NumPoints = Positions.Num();
+	// Points only move a little between iterations; repair the previous triangulation and rebuild only when it can't be
+	if (!Delaunay->Repair(View) && !Delaunay->Process(View, true)) { return false; }
 
-	TArray<FVector> Sum;
-	TArray<double> Counts;
-	Sum.Append(*ActivePositions);
-	Counts.SetNum(NumPoints);
-	for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
-
-	FVector Centroid;
-	for (const PCGExGeo::FDelaunaySite3& Site : Delaunay->Sites)
-	{
-		PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-		for (const int32 PtIndex : Site.Vtx)
-		{
-			Counts[PtIndex] += 1;
-			Sum[PtIndex] += Centroid;
-		}
-	}
+	TArray<FVector> Averages;
+	PCGExGeo::GetCentroidAverages(View, Delaunay->Sites, Averages);
 
 	if (InfluenceSettings->bProgressiveInfluence && InfluenceGetter)
 	{
-		for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceGetter->SafeGet(i, InfluenceSettings->Influence)); }
+		PCGExMT::ParallelFor(
+			Positions.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				Positions[i] = FMath::Lerp(Positions[i], Averages[i], InfluenceGetter->SafeGet(i, InfluenceSettings->Influence));
+			});
 	}
 	else
 	{
-		for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->Influence); }
+		PCGExMT::ParallelFor(
+			Positions.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				Positions[i] = FMath::Lerp(Positions[i], Averages[i], InfluenceSettings->Influence);
+			});
 	}
 
-	PCGEX_DELETE(Delaunay)
-
 	if (NumIterations > 0)
 	{
-		Manager->Start<FPCGExLloydRelax3Task>(TaskIndex + 1, PointIO, ActivePositions, InfluenceSettings, NumIterations);
+		Manager->Start<FPCGExLloydRelax3Task>(TaskIndex + 1, PointIO, ActivePositions, Delaunay, InfluenceSettings, NumIterations, InfluenceGetter);
 	}
 
 	return true;
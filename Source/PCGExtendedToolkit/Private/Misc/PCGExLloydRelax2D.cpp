@@ -17,6 +17,7 @@ FPCGExLloydRelax2DContext::~FPCGExLloydRelax2DContext()
 	PCGEX_TERMINATE_ASYNC
 
 	PCGEX_DELETE(InfluenceGetter)
+	PCGEX_DELETE(Delaunay)
 	ProjectionSettings.Cleanup();
 
 	ActivePositions.Empty();
@@ -31,6 +32,8 @@ bool FPCGExLloydRelax2DElement::Boot(FPCGContext* InContext) const
 	Context->InfluenceGetter = new PCGEx::FLocalSingleFieldGetter();
 	Context->InfluenceGetter->Capture(Settings->InfluenceSettings.LocalInfluence);
 
+	Context->Delaunay = new PCGExGeo::TDelaunay2();
+
 	PCGEX_FWD(ProjectionSettings)
 
 	return true;
@@ -62,11 +65,12 @@ bool FPCGExLloydRelax2DElement::ExecuteInternal(FPCGContext* InContext) const
 			Context->CurrentIO->CreateInKeys();
 			Context->InfluenceGetter->Grab(*Context->CurrentIO);
 			PCGExGeo::PointsToPositions(Context->CurrentIO->GetIn()->GetPoints(), Context->ActivePositions);
+			Context->Delaunay->Clear();
 
 			Context->ProjectionSettings.Init(Context->CurrentIO);
 
 			Context->GetAsyncManager()->Start<FPCGExLloydRelax2Task>(
-				0, nullptr, &Context->ActivePositions,
+				0, nullptr, &Context->ActivePositions, Context->Delaunay,
 				&Settings->InfluenceSettings, Settings->Iterations, Context->InfluenceGetter, &Context->ProjectionSettings);
 
 
@@ -123,45 +127,35 @@ bool FPCGExLloydRelax2Task::ExecuteTask()
 {
 	NumIterations--;
 
-	PCGExGeo::TDelaunay2* Delaunay = new PCGExGeo::TDelaunay2();
 	TArray<FVector>& Positions = *ActivePositions;
-
 	const TArrayView<FVector> View = MakeArrayView(Positions);
-	if (!Delaunay->Process(View, *ProjectionSettings)) { return false; }
 
-	const int32 NumPoints = Positions.Num();
+	// Points only move a little between iterations; repair the previous triangulation and rebuild only when it can't be
+	if (!Delaunay->Repair(View, *ProjectionSettings) && !Delaunay->Process(View, *ProjectionSettings)) { return false; }
 
-	TArray<FVector> Sum;
-	TArray<double> Counts;
-	Sum.Append(*ActivePositions);
-	Counts.SetNum(NumPoints);
-	for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
-
-	FVector Centroid;
-	for (const PCGExGeo::FDelaunaySite2& Site : Delaunay->Sites)
-	{
-		PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-		for (const int32 PtIndex : Site.Vtx)
-		{
-			Counts[PtIndex] += 1;
-			Sum[PtIndex] += Centroid;
-		}
-	}
+	TArray<FVector> Averages;
+	PCGExGeo::GetCentroidAverages(View, Delaunay->Sites, Averages);
 
 	if (InfluenceSettings->bProgressiveInfluence && InfluenceGetter)
 	{
-		for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceGetter->SafeGet(i, InfluenceSettings->Influence)); }
+		PCGExMT::ParallelFor(
+			Positions.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				Positions[i] = FMath::Lerp(Positions[i], Averages[i], InfluenceGetter->SafeGet(i, InfluenceSettings->Influence));
+			});
 	}
 	else
 	{
-		for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->Influence); }
+		PCGExMT::ParallelFor(
+			Positions.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				Positions[i] = FMath::Lerp(Positions[i], Averages[i], InfluenceSettings->Influence);
+			});
 	}
 
-	PCGEX_DELETE(Delaunay)
-
 	if (NumIterations > 0)
 	{
-		Manager->Start<FPCGExLloydRelax2Task>(TaskIndex + 1, PointIO, ActivePositions, InfluenceSettings, NumIterations, InfluenceGetter, ProjectionSettings);
+		Manager->Start<FPCGExLloydRelax2Task>(TaskIndex + 1, PointIO, ActivePositions, Delaunay, InfluenceSettings, NumIterations, InfluenceGetter, ProjectionSettings);
 	}
 
 	return true;
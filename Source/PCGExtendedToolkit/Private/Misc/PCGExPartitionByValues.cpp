@@ -23,52 +23,14 @@ namespace PCGExPartition
 
 	FKPartition::~FKPartition()
 	{
-		PCGEX_DELETE_TMAP(SubLayers, int64)
-		UniquePartitionKeys.Empty();
-	}
-
-	int32 FKPartition::GetSubPartitionsNum()
-	{
-		if (SubLayers.IsEmpty()) { return 1; }
-
-		int32 Num = 0;
-		for (const TPair<int64, FKPartition*>& Pair : SubLayers) { Num += Pair.Value->GetSubPartitionsNum(); }
-		return Num;
-	}
-
-	FKPartition* FKPartition::GetPartition(const int64 Key, FPCGExFilter::FRule* InRule)
-	{
-		FKPartition** LayerPtr;
-
-		{
-			FReadScopeLock ReadLock(LayersLock);
-			LayerPtr = SubLayers.Find(Key);
-		}
-
-		if (!LayerPtr)
-		{
-			FWriteScopeLock WriteLock(LayersLock);
-			FKPartition* Partition = new FKPartition(this, Key, InRule, SubLayers.Num());
-
-			UniquePartitionKeys.Add(Key);
-			SubLayers.Add(Key, Partition);
-			return Partition;
-		}
-
-		return *LayerPtr;
-	}
-
-	void FKPartition::Add(const int64 Index)
-	{
-		FWriteScopeLock WriteLock(PointLock);
-		Points.Add(Index);
+		PCGEX_DELETE_TARRAY(SubLayers)
 	}
 
 	void FKPartition::Register(TArray<FKPartition*>& Partitions)
 	{
 		if (!SubLayers.IsEmpty())
 		{
-			for (const TPair<int64, FKPartition*>& Pair : SubLayers) { Pair.Value->Register(Partitions); }
+			for (FKPartition* SubLayer : SubLayers) { SubLayer->Register(Partitions); }
 		}
 		else
 		{
@@ -76,24 +38,66 @@ namespace PCGExPartition
 		}
 	}
 
-	void FKPartition::SortPartitions()
+	void BuildPartitions(FKPartition* Root, TArray<FPCGExFilter::FRule>& Rules, const int32 NumPoints, TArray<int32>& OutIndices)
 	{
-		TMap<int64, int64> ValuesIndices;
-		TArray<int64> UValues = UniquePartitionKeys.Array();
-		UValues.Sort();
+		Root->Start = 0;
+		Root->Count = NumPoints;
+
+		PCGEx::ArrayOfIndices(OutIndices, NumPoints);
+		if (NumPoints == 0) { return; }
 
-		int64 PIndex = 0;
-		for (int64 UniquePartitionKey : UValues) { ValuesIndices.Add(UniquePartitionKey, PIndex++); }
-		UValues.Empty();
+		TArray<FKPartition*> Parents = {Root}; // Partitions of the previous layer, by group index
+		TArray<int32> Groups;                  // Group index of each point in the previous layer
+		TArray<int32> Ranks;
+		TArray<uint64> Keys;
 
-		for (const TPair<int64, FKPartition*>& Pair : SubLayers)
+		Groups.SetNumZeroed(NumPoints);
+		Keys.SetNumUninitialized(NumPoints);
+
+		for (FPCGExFilter::FRule& Rule : Rules)
 		{
-			Pair.Value->SortPartitions();
-			Pair.Value->PartitionIndex = *ValuesIndices.Find(Pair.Value->PartitionKey); //Ordered index
-		}
+			PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { Keys[i] = static_cast<uint64>(Rule.FilteredValues[i]) ^ (1ULL << 63); });
+
+			PCGEx::ArrayOfIndices(OutIndices, NumPoints);
+			PCGExMT::ParallelRadixSort(Keys, OutIndices);
+
+			if (Parents.Num() > 1)
+			{
+				// Keys are 64 bits wide; rank them so they fit next to the parent group
+				Ranks.SetNumUninitialized(NumPoints);
+
+				int32 Rank = 0;
+				for (int i = 0; i < NumPoints; i++)
+				{
+					if (i > 0 && Keys[i] != Keys[i - 1]) { Rank++; }
+					Ranks[OutIndices[i]] = Rank;
+				}
+
+				PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { Keys[i] = static_cast<uint64>(Groups[i]) << 32 | static_cast<uint32>(Ranks[i]); });
+
+				PCGEx::ArrayOfIndices(OutIndices, NumPoints);
+				PCGExMT::ParallelRadixSort(Keys, OutIndices);
+			}
+
+			TArray<FKPartition*> Children;
+			for (int i = 0; i < NumPoints; i++)
+			{
+				const int32 PointIndex = OutIndices[i];
 
-		ValuesIndices.Empty();
-		UniquePartitionKeys.Empty();
+				if (i == 0 || Keys[i] != Keys[i - 1])
+				{
+					FKPartition* Parent = Parents[Groups[PointIndex]];
+					FKPartition* Child = Parent->SubLayers.Add_GetRef(new FKPartition(Parent, Rule.FilteredValues[PointIndex], &Rule, Parent->SubLayers.Num()));
+					Child->Start = i;
+					Children.Add(Child);
+				}
+
+				Children.Last()->Count++;
+				Groups[PointIndex] = Children.Num() - 1;
+			}
+
+			Parents = MoveTemp(Children);
+		}
 	}
 }
 
@@ -114,6 +118,7 @@ FPCGExPartitionByValuesContext::~FPCGExPartitionByValuesContext()
 {
 	PCGEX_DELETE(RootPartition)
 	KeySums.Empty();
+	PartitionedIndices.Reset();
 }
 
 PCGEX_INITIALIZE_ELEMENT(PartitionByValues)
@@ -199,26 +204,18 @@ bool FPCGExPartitionByValuesElement::ExecuteInternal(FPCGContext* InContext) con
 
 		auto ProcessPoint = [&](const int32 PointIndex, const PCGExData::FPointIO& PointIO)
 		{
-			PCGExPartition::FKPartition* Partition = Context->RootPartition;
-			for (FPCGExFilter::FRule& Rule : Context->Rules)
-			{
-				const int64 KeyValue = Rule.Filter(PointIndex);
-				Partition = Partition->GetPartition(KeyValue, &Rule);
-				Rule.FilteredValues[PointIndex] = KeyValue;
-			}
-
-			Partition->Add(PointIndex);
+			for (FPCGExFilter::FRule& Rule : Context->Rules) { Rule.FilteredValues[PointIndex] = Rule.Filter(PointIndex); }
 		};
 
 		if (!Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { return false; }
 
-		Context->RootPartition->SortPartitions();
-
 		if (Context->bSplitOutput)
 		{
-			Context->NumPartitions = Context->RootPartition->GetSubPartitionsNum();
-			Context->Partitions.Reserve(Context->NumPartitions);
+			Context->PartitionedIndices = MakeShared<TArray<int32>>();
+			PCGExPartition::BuildPartitions(Context->RootPartition, Context->Rules, Context->CurrentIO->GetNum(), *Context->PartitionedIndices);
+
 			Context->RootPartition->Register(Context->Partitions);
+			Context->NumPartitions = Context->Partitions.Num();
 
 			Context->SetState(PCGExPartition::State_DistributeToPartition);
 		}
@@ -274,14 +271,28 @@ bool FPCGExPartitionByValuesElement::ExecuteInternal(FPCGContext* InContext) con
 			Tags->Append(Context->CurrentIO->Tags);
 			PCGExPartition::FKPartition* Partition = Context->Partitions[Index];
 			const UPCGPointData* InData = Context->GetCurrentIn();
-			UPCGPointData* OutData = NewObject<UPCGPointData>();
-			OutData->InitializeFromData(InData);
+			UPCGSpatialData* OutData;
 
-			const TArray<FPCGPoint>& InPoints = InData->GetPoints();
-			TArray<FPCGPoint>& OutPoints = OutData->GetMutablePoints();
-			OutPoints.Reserve(Partition->Points.Num());
+			if (Settings->bOutputIndexViews)
+			{
+				UPCGExPointIndexViewData* OutView = NewObject<UPCGExPointIndexViewData>();
+				OutView->Initialize(InData, Context->PartitionedIndices, Partition->Start, Partition->Count);
+				OutData = OutView;
+			}
+			else
+			{
+				UPCGPointData* OutPointData = NewObject<UPCGPointData>();
+				OutPointData->InitializeFromData(InData);
 
-			for (const int32 PointIndex : Partition->Points) { OutPoints.Add(InPoints[PointIndex]); }
+				const TArray<FPCGPoint>& InPoints = InData->GetPoints();
+				const TArray<int32>& Indices = *Context->PartitionedIndices;
+				TArray<FPCGPoint>& OutPoints = OutPointData->GetMutablePoints();
+				OutPoints.Reserve(Partition->Count);
+
+				for (int i = Partition->Start; i < Partition->Start + Partition->Count; i++) { OutPoints.Add(InPoints[Indices[i]]); }
+
+				OutData = OutPointData;
+			}
 
 			int64 Sum = 0;
 			while (Partition->Parent)
@@ -312,7 +323,7 @@ bool FPCGExPartitionByValuesElement::ExecuteInternal(FPCGContext* InContext) con
 			if (Settings->bWriteKeySum) { PCGExData::WriteMark<int64>(OutData->Metadata, Settings->KeySumAttributeName, Sum); }
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
-			OutData->Metadata->Flatten();	
+			if (!Settings->bOutputIndexViews) { OutData->Metadata->Flatten(); } // Views flatten once materialized
 #endif
 			FPCGTaggedData* TaggedData = Context->Output(OutData, Context->MainPoints->DefaultOutputLabel);
 			Tags->Dump(TaggedData->Tags);
@@ -57,6 +57,26 @@ bool FPCGExSortPointsElement::ExecuteInternal(FPCGContext* InContext) const
 	return Context->IsDone();
 }
 
+namespace PCGExSortPoints
+{
+	/** Order-preserving integer for a rule value; values are bucketed by tolerance when there is one. */
+	static uint64 GetSortKey(const double Value, const double Tolerance)
+	{
+		constexpr uint64 SignBit = 1ULL << 63;
+
+		if (Tolerance > 0)
+		{
+			constexpr double Limit = 4e18;
+			const int64 Bucket = static_cast<int64>(FMath::Clamp(FMath::FloorToDouble(Value / Tolerance), -Limit, Limit));
+			return static_cast<uint64>(Bucket) ^ SignBit;
+		}
+
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(double));
+		return Bits & SignBit ? ~Bits : Bits | SignBit;
+	}
+}
+
 bool FPCGExSortPointIO::ExecuteTask()
 {
 	const FPCGExPointsProcessorContext* Context = Manager->GetContext<FPCGExPointsProcessorContext>();
@@ -64,10 +84,6 @@ bool FPCGExSortPointIO::ExecuteTask()
 	TArray<FPCGExSortRule*> Rules;
 	Rules.Reserve(Settings->Rules.Num());
 
-	PointIO->CreateOutKeys(); //Initialize metadata keys
-	TMap<PCGMetadataEntryKey, int32> PointIndices;
-	PointIO->PrintOutKeysMap(PointIndices, true);
-
 	for (const FPCGExSortRuleDescriptor& RuleDescriptor : Settings->Rules)
 	{
 		FPCGExSortRule* NewRule = new FPCGExSortRule();
@@ -88,34 +104,96 @@ bool FPCGExSortPointIO::ExecuteTask()
 	if (Rules.IsEmpty())
 	{
 		// Don't sort
-		PointIndices.Empty();
 		return false;
 	}
 
-	auto SortPredicate = [&](const FPCGPoint& A, const FPCGPoint& B)
+	const int32 NumPoints = PointIO->GetNum();
+	const bool bDescending = Settings->SortDirection == EPCGExSortDirection::Descending;
+
+	// Each rule becomes an integer key rebased on its minimum, so it only spans the bits it needs.
+	// Keys are then packed into as few 64-bit words as possible, most significant rule first.
+
+	TArray<TArray<uint64>> RuleKeys;
+	TArray<int32> RuleBits;
+	RuleKeys.SetNum(Rules.Num());
+	RuleBits.SetNum(Rules.Num());
+
+	TArray<TArray<int32>> Words; // Rules packed in each word
+	int32 WordBits = 64;
+
+	for (int r = 0; r < Rules.Num(); r++)
 	{
-		int Result = 0;
-		for (const FPCGExSortRule* Rule : Rules)
+		const FPCGExSortRule* Rule = Rules[r];
+		TArray<uint64>& Keys = RuleKeys[r];
+		Keys.SetNumUninitialized(NumPoints);
+
+		PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { Keys[i] = PCGExSortPoints::GetSortKey(Rule->Values[i], Rule->Tolerance); });
+
+		uint64 Min = MAX_uint64;
+		uint64 Max = 0;
+		for (const uint64 Key : Keys)
 		{
-			const double ValueA = Rule->Values[*PointIndices.Find(A.MetadataEntry)];
-			const double ValueB = Rule->Values[*PointIndices.Find(B.MetadataEntry)];
-			Result = FMath::IsNearlyEqual(ValueA, ValueB, Rule->Tolerance) ? 0 : ValueA < ValueB ? -1 : 1;
-			if (Result != 0)
-			{
-				if (Rule->bInvertRule) { Result *= -1; }
-				break;
-			}
+			Min = FMath::Min(Min, Key);
+			Max = FMath::Max(Max, Key);
 		}
 
-		if (Settings->SortDirection == EPCGExSortDirection::Descending) { Result *= -1; }
-		return Result < 0;
-	};
+		if (Min == Max) { continue; } // Can't tell points apart
 
-	PointIO->GetOut()->GetMutablePoints().Sort(SortPredicate);
+		const bool bInvert = Rule->bInvertRule != bDescending;
+		PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { Keys[i] = bInvert ? Max - Keys[i] : Keys[i] - Min; });
+
+		RuleBits[r] = 64 - FMath::CountLeadingZeros64(Max - Min);
+
+		if (WordBits + RuleBits[r] > 64)
+		{
+			Words.Emplace();
+			WordBits = 0;
+		}
+
+		Words.Last().Add(r);
+		WordBits += RuleBits[r];
+	}
 
-	PointIndices.Empty();
 	PCGEX_DELETE_TARRAY(Rules)
 
+	if (Words.IsEmpty()) { return true; }
+
+	// Stable LSD pass per word, least significant word first
+
+	TArray<int32> Order;
+	PCGEx::ArrayOfIndices(Order, NumPoints);
+
+	TArray<uint64> SortKeys;
+	SortKeys.SetNumUninitialized(NumPoints);
+
+	for (int w = Words.Num() - 1; w >= 0; w--)
+	{
+		const TArray<int32>& WordRules = Words[w];
+
+		PCGExMT::ParallelFor(
+			NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				const int32 Index = Order[i];
+				uint64 Key = 0;
+				for (const int32 r : WordRules) { Key = (RuleBits[r] < 64 ? Key << RuleBits[r] : 0) | RuleKeys[r][Index]; }
+				SortKeys[i] = Key;
+			});
+
+		PCGExMT::ParallelRadixSort(SortKeys, Order);
+	}
+
+	RuleKeys.Empty();
+	SortKeys.Empty();
+
+	// Apply the permutation once; points are written back into the same buffer
+
+	TArray<FPCGPoint>& MutablePoints = PointIO->GetOut()->GetMutablePoints();
+	TArray<FPCGPoint> SortedPoints;
+	SortedPoints.SetNumUninitialized(NumPoints);
+
+	PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { SortedPoints[i] = MutablePoints[Order[i]]; });
+	PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { MutablePoints[i] = SortedPoints[i]; });
+
 	return true;
 }
 
@@ -4,6 +4,215 @@
 
 #include "PCGExMT.h"
 
+#include "Tasks/Task.h"
+
+namespace PCGExMT
+{
+	static uint64 PackRange(const int32 Begin, const int32 End) { return (static_cast<uint64>(static_cast<uint32>(Begin)) << 32) | static_cast<uint32>(End); }
+	static int32 RangeBegin(const uint64 Range) { return static_cast<int32>(Range >> 32); }
+	static int32 RangeEnd(const uint64 Range) { return static_cast<int32>(Range & 0xFFFFFFFF); }
+
+	FParallelForState::FParallelForState(const int32 InNumIterations, const int32 InNumWorkers, TFunction<void(int32)>&& InBody)
+		: Body(MoveTemp(InBody)),
+		  NumWorkers(FMath::Clamp(InNumWorkers, 1, FMath::Max(1, InNumIterations)))
+	{
+		Slices = MakeUnique<FSlice[]>(NumWorkers);
+		for (int i = 0; i < NumWorkers; i++)
+		{
+			const int32 Begin = static_cast<int32>(static_cast<int64>(InNumIterations) * i / NumWorkers);
+			const int32 End = static_cast<int32>(static_cast<int64>(InNumIterations) * (i + 1) / NumWorkers);
+			Slices[i].Range.store(PackRange(Begin, End));
+		}
+	}
+
+	void FParallelForState::RunWorker(const int32 WorkerIndex)
+	{
+		FSlice& OwnSlice = Slices[WorkerIndex];
+
+		double SecondsPerIteration = -1;
+		int32 ChunkSize = GParallelForInitialChunk;
+		int32 Begin = 0;
+		int32 End = 0;
+
+		while (true)
+		{
+			if (!TakeFront(OwnSlice, ChunkSize, Begin, End))
+			{
+				bool bStolen = false;
+				for (int i = 1; i < NumWorkers && !bStolen; i++) { bStolen = StealBack(Slices[(WorkerIndex + i) % NumWorkers], Begin, End); }
+				if (!bStolen) { return; }
+
+				// Own slice is empty, publish the stolen range so it can be split again by others
+				OwnSlice.Range.store(PackRange(Begin, End));
+				continue;
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int i = Begin; i < End; i++) { Body(i); }
+			const double ChunkSecondsPerIteration = (FPlatformTime::Seconds() - StartTime) / (End - Begin);
+
+			SecondsPerIteration = SecondsPerIteration < 0 ? ChunkSecondsPerIteration : (SecondsPerIteration + ChunkSecondsPerIteration) * 0.5;
+			ChunkSize = SecondsPerIteration > 0 ?
+				            static_cast<int32>(FMath::Clamp(GParallelForChunkBudget / SecondsPerIteration, 1.0, static_cast<double>(GParallelForMaxChunk))) :
+				            GParallelForMaxChunk;
+		}
+	}
+
+	bool FParallelForState::TakeFront(FSlice& Slice, const int32 Count, int32& OutBegin, int32& OutEnd)
+	{
+		uint64 Range = Slice.Range.load();
+		while (true)
+		{
+			const int32 Begin = RangeBegin(Range);
+			const int32 End = RangeEnd(Range);
+			if (Begin >= End) { return false; }
+
+			const int32 NewBegin = FMath::Min(End, Begin + Count);
+			if (Slice.Range.compare_exchange_weak(Range, PackRange(NewBegin, End)))
+			{
+				OutBegin = Begin;
+				OutEnd = NewBegin;
+				return true;
+			}
+		}
+	}
+
+	bool FParallelForState::StealBack(FSlice& Slice, int32& OutBegin, int32& OutEnd)
+	{
+		uint64 Range = Slice.Range.load();
+		while (true)
+		{
+			const int32 Begin = RangeBegin(Range);
+			const int32 End = RangeEnd(Range);
+			if (Begin >= End) { return false; }
+
+			const int32 Mid = Begin + (End - Begin) / 2;
+			if (Slice.Range.compare_exchange_weak(Range, PackRange(Begin, Mid)))
+			{
+				OutBegin = Mid;
+				OutEnd = End;
+				return true;
+			}
+		}
+	}
+
+	void ParallelFor(const int32 NumIterations, const int32 NumWorkers, TFunctionRef<void(int32)> Body)
+	{
+		if (NumIterations <= 0) { return; }
+
+		if (NumWorkers <= 1 || NumIterations <= GParallelForInitialChunk)
+		{
+			for (int i = 0; i < NumIterations; i++) { Body(i); }
+			return;
+		}
+
+		FParallelForState State(NumIterations, NumWorkers, [&Body](const int32 Index) { Body(Index); });
+
+		TArray<UE::Tasks::FTask> Helpers;
+		Helpers.Reserve(State.GetNumWorkers() - 1);
+		for (int i = 1; i < State.GetNumWorkers(); i++)
+		{
+			Helpers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&State, i]() { State.RunWorker(i); }));
+		}
+
+		State.RunWorker(0);
+
+		// Helpers that haven't started yet are retracted & run here, finding nothing left to do
+		UE::Tasks::Wait(Helpers);
+	}
+
+	void ParallelRadixSort(TArray<uint64>& Keys, TArray<int32>& Values)
+	{
+		check(Values.Num() == Keys.Num())
+
+		constexpr int32 MinChunkSize = 1 << 16;
+
+		const int32 Num = Keys.Num();
+		const int32 NumChunks = FMath::Min(GetNumPoolWorkers() * 4, Num / MinChunkSize);
+
+		if (NumChunks <= 1)
+		{
+			PCGEx::RadixSort(Keys, Values);
+			return;
+		}
+
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		uint64 AllOr = 0;
+		uint64 AllAnd = ~0ULL;
+		for (const uint64 Key : Keys)
+		{
+			AllOr |= Key;
+			AllAnd &= Key;
+		}
+		const uint64 VaryingBits = AllOr ^ AllAnd;
+
+		TArray<uint64> KeysBuffer;
+		TArray<int32> ValuesBuffer;
+		KeysBuffer.SetNumUninitialized(Num);
+		ValuesBuffer.SetNumUninitialized(Num);
+
+		uint64* SrcKeys = Keys.GetData();
+		int32* SrcValues = Values.GetData();
+		uint64* DstKeys = KeysBuffer.GetData();
+		int32* DstValues = ValuesBuffer.GetData();
+
+		TArray<int32> Offsets; // Chunk * 256 + Digit
+		Offsets.SetNumUninitialized(NumChunks * 256);
+
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
+		{
+			if (((VaryingBits >> Shift) & 0xFF) == 0) { continue; }
+
+			ParallelFor(
+				NumChunks, NumChunks, [&](const int32 Chunk)
+				{
+					int32* Histogram = Offsets.GetData() + Chunk * 256;
+					FMemory::Memzero(Histogram, 256 * sizeof(int32));
+
+					const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+					for (int i = Chunk * ChunkSize; i < End; i++) { Histogram[(SrcKeys[i] >> Shift) & 0xFF]++; }
+				});
+
+			// Digit-major, chunk-minor prefix keeps the scatter stable
+			int32 Sum = 0;
+			for (int Digit = 0; Digit < 256; Digit++)
+			{
+				for (int Chunk = 0; Chunk < NumChunks; Chunk++)
+				{
+					int32& Offset = Offsets[Chunk * 256 + Digit];
+					const int32 Count = Offset;
+					Offset = Sum;
+					Sum += Count;
+				}
+			}
+
+			ParallelFor(
+				NumChunks, NumChunks, [&](const int32 Chunk)
+				{
+					int32* ChunkOffsets = Offsets.GetData() + Chunk * 256;
+
+					const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+					for (int i = Chunk * ChunkSize; i < End; i++)
+					{
+						const int32 Target = ChunkOffsets[(SrcKeys[i] >> Shift) & 0xFF]++;
+						DstKeys[Target] = SrcKeys[i];
+						DstValues[Target] = SrcValues[i];
+					}
+				});
+
+			Swap(SrcKeys, DstKeys);
+			Swap(SrcValues, DstValues);
+		}
+
+		if (SrcKeys != Keys.GetData())
+		{
+			FMemory::Memcpy(Keys.GetData(), SrcKeys, Num * sizeof(uint64));
+			FMemory::Memcpy(Values.GetData(), SrcValues, Num * sizeof(int32));
+		}
+	}
+}
+
 FPCGExAsyncManager::~FPCGExAsyncManager()
 {
 	bStopped = true;
@@ -13,29 +222,56 @@ FPCGExAsyncManager::~FPCGExAsyncManager()
 void FPCGExAsyncManager::OnAsyncTaskExecutionComplete(FPCGExNonAbandonableTask* AsyncTask, bool bSuccess)
 {
 	if (bFlushing) { return; }
-	FWriteScopeLock WriteLock(ManagerLock);
-	NumCompleted++;
+	NumCompleted.fetch_add(1);
 }
 
 bool FPCGExAsyncManager::IsAsyncWorkComplete() const
 {
-	FReadScopeLock ReadLock(ManagerLock);
-	return NumCompleted == NumStarted;
+	// A task is always counted as started before it can complete,
+	// so reading completions first can never report a false positive.
+	const int32 Completed = NumCompleted.load();
+	return Completed == NumStarted.load();
 }
 
 void FPCGExAsyncManager::Reset()
 {
-	FWriteScopeLock WriteLock(ManagerLock);
-
 	bFlushing = true;
-	for (FAsyncTaskBase* Task : QueuedTasks)
+
+	// Wait for starts that were already past their flag check; any later one sees bFlushing and bails.
+	while (NumStarting.load() > 0) { FPlatformProcess::Yield(); }
+
+	// Tasks retired here may have been started from others, drain until nothing is left.
+	while (FPCGExNonAbandonableTask* Task = TrackedTasks.exchange(nullptr))
 	{
-		if (Task && !Task->Cancel()) { Task->EnsureCompletion(); }
-		delete Task;
+		while (Task)
+		{
+			FPCGExNonAbandonableTask* Next = Task->NextTracked;
+			FAsyncTaskBase* AsyncTask = Task->TaskPtr;
+			if (!AsyncTask->Cancel()) { AsyncTask->EnsureCompletion(); }
+			delete AsyncTask;
+			Task = Next;
+		}
 	}
+
 	bFlushing = false;
 
-	QueuedTasks.Empty();
-	NumStarted = 0;
-	NumCompleted = 0;
+	NumStarted.store(0);
+	NumCompleted.store(0);
+}
+
+void FPCGExAsyncManager::Track(FPCGExNonAbandonableTask* InTask)
+{
+	FPCGExNonAbandonableTask* Head = TrackedTasks.load();
+	do { InTask->NextTracked = Head; }
+	while (!TrackedTasks.compare_exchange_weak(Head, InTask));
+}
+
+void FPCGExAsyncManager::StartParallelFor(const int32 NumIterations, TFunction<void(int32)>&& Body, const int32 NumWorkers)
+{
+	if (bStopped || NumIterations <= 0) { return; }
+
+	const TSharedPtr<PCGExMT::FParallelForState> State = MakeShared<PCGExMT::FParallelForState>(
+		NumIterations, NumWorkers <= 0 ? PCGExMT::GetNumPoolWorkers() : NumWorkers, MoveTemp(Body));
+
+	for (int i = 0; i < State->GetNumWorkers(); i++) { Start<FPCGExParallelForTask>(i, nullptr, State); }
 }
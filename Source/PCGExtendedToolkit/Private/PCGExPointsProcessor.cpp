@@ -10,6 +10,20 @@
 #define LOCTEXT_NAMESPACE "PCGExGraphSettings"
 
 
+#pragma region Batch
+
+int64 PCGExPointsMT::FPointsProcessor::GetEstimatedMemory() const
+{
+	// Input points + their output copy
+	return static_cast<int64>(PointIO->GetNum()) * sizeof(FPCGPoint) * 2;
+}
+
+void PCGExPointsMT::FPointsProcessor::CompleteWork()
+{
+}
+
+#pragma endregion
+
 #pragma region Loops
 
 PCGExData::FPointIO& PCGEx::FAPointLoop::GetPointIO() const { return PointIO ? *PointIO : *Context->CurrentIO; }
@@ -266,6 +280,7 @@ FPCGExPointsProcessorContext::~FPCGExPointsProcessorContext()
 	ProcessorOperations.Empty();
 	OwnedProcessorOperations.Empty();
 
+	PCGEX_DELETE_TARRAY(BatchProcessors)
 	PCGEX_DELETE(MainPoints)
 
 	CurrentIO = nullptr;
@@ -315,6 +330,61 @@ bool FPCGExPointsProcessorContext::ProcessCurrentPoints(TFunction<void(const int
 	return bForceSync ? ChunkedPointLoop.Advance(std::move(LoopBody)) : AsyncPointLoop.Advance(std::move(LoopBody));
 }
 
+bool FPCGExPointsProcessorContext::ProcessPointsBatch()
+{
+	StartBatchProcessors();
+
+	{
+		FReadScopeLock ReadLock(BatchLock);
+		if (BatchCursor < BatchProcessors.Num()) { return false; }
+	}
+
+	if (!IsAsyncWorkComplete()) { return false; }
+
+	for (PCGExPointsMT::FPointsProcessor* Processor : BatchProcessors) { Processor->CompleteWork(); }
+	PCGEX_DELETE_TARRAY(BatchProcessors)
+
+	return true;
+}
+
+void FPCGExPointsProcessorContext::OnBatchProcessorComplete(const PCGExPointsMT::FPointsProcessor* Processor)
+{
+	{
+		FWriteScopeLock WriteLock(BatchLock);
+		BatchMemoryInFlight -= Processor->GetEstimatedMemory();
+	}
+
+	// Synchronous processing is driven by ProcessPointsBatch only, to avoid unbounded recursion
+	if (bDoAsyncProcessing) { StartBatchProcessors(); }
+}
+
+void FPCGExPointsProcessorContext::StartBatchProcessors()
+{
+	TArray<PCGExPointsMT::FPointsProcessor*> ReadyProcessors;
+
+	{
+		FWriteScopeLock WriteLock(BatchLock);
+		while (BatchProcessors.IsValidIndex(BatchCursor))
+		{
+			PCGExPointsMT::FPointsProcessor* Processor = BatchProcessors[BatchCursor];
+			const int64 Memory = Processor->GetEstimatedMemory();
+
+			// Always let at least one processor through, no matter its size
+			if (BatchMemoryInFlight > 0 && BatchMemoryInFlight + Memory > BatchMemoryBudget) { break; }
+
+			BatchMemoryInFlight += Memory;
+			BatchCursor++;
+			ReadyProcessors.Add(Processor);
+		}
+	}
+
+	// Started outside the lock since synchronous tasks complete (and re-enter) immediately
+	for (PCGExPointsMT::FPointsProcessor* Processor : ReadyProcessors)
+	{
+		GetAsyncManager()->Start<FPCGExProcessPointsTask>(Processor->BatchIndex, Processor->PointIO, Processor);
+	}
+}
+
 void FPCGExPointsProcessorContext::Output(FPCGTaggedData& OutTaggedData, UPCGData* OutData, const FName OutputLabel)
 {
 	FWriteScopeLock WriteLock(ContextLock);
@@ -465,4 +535,11 @@ bool FPCGExPointsProcessorElementBase::Boot(FPCGContext* InContext) const
 	return true;
 }
 
+bool FPCGExProcessPointsTask::ExecuteTask()
+{
+	const bool bResult = Processor->Process(Manager);
+	Manager->GetContext<FPCGExPointsProcessorContext>()->OnBatchProcessorComplete(Processor);
+	return bResult;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -3,17 +3,31 @@
 
 #include "PCGExtendedToolkit.h"
 
+#include "Graph/PCGExCluster.h"
+#include "UObject/UObjectGlobals.h"
+
 #define LOCTEXT_NAMESPACE "FPCGExtendedToolkitModule"
 
 void FPCGExtendedToolkitModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module	
+
+	// Cached clusters live as long as the edges data they were built from
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FPCGExtendedToolkitModule::OnPostGarbageCollect);
 }
 
 void FPCGExtendedToolkitModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+	PCGExCluster::FClusterCache::Get().Flush();
+}
+
+void FPCGExtendedToolkitModule::OnPostGarbageCollect()
+{
+	PCGExCluster::FClusterCache::Get().PurgeStale();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -63,32 +63,27 @@ bool FPCGExWritePathExtrasElement::ExecuteInternal(FPCGContext* InContext) const
 
 	if (Context->IsState(PCGExMT::State_ReadyForNextPoints))
 	{
-		if (!Context->AdvancePointsIO()) { Context->Done(); }
-		else
-		{
-			if (Context->CurrentIO->GetNum() < 2)
+		bool bInvalidInputs = false;
+		Context->StartBatchProcessingPoints<PCGExWritePathExtras::FProcessor>(
+			[&](const PCGExData::FPointIO& PointIO)
 			{
-				PCGE_LOG(Warning, GraphAndLog, FTEXT("Some inputs have less that the than 2 points and will be discarded."));
-				return false;
-			}
-
-			PCGExData::FPointIO& PointIO = *Context->CurrentIO;
-			PointIO.InitializeOutput(PCGExData::EInit::DuplicateInput);
+				if (PointIO.GetNum() < 2)
+				{
+					bInvalidInputs = true;
+					return false;
+				}
+				return true;
+			});
 
-			PCGEX_FOREACH_FIELD_PATHEXTRAS(PCGEX_OUTPUT_ACCESSOR_INIT)
+		if (bInvalidInputs) { PCGE_LOG(Warning, GraphAndLog, FTEXT("Some inputs have less that the than 2 points and will be discarded.")); }
 
-			Context->CurrentIO->CreateInKeys();
-			Context->GetAsyncManager()->Start<FPCGExWritePathExtrasTask>(Context->CurrentPointIOIndex, Context->CurrentIO);
-
-			Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
-		}
+		Context->SetAsyncState(PCGExMT::State_ProcessingPoints);
 	}
 
-	if (Context->IsState(PCGExMT::State_WaitingOnAsyncWork))
+	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
-		PCGEX_WAIT_ASYNC
-		PCGEX_FOREACH_FIELD_PATHEXTRAS(PCGEX_OUTPUT_WRITE)
-		Context->SetState(PCGExMT::State_ReadyForNextPoints);
+		if (!Context->ProcessPointsBatch()) { return false; }
+		Context->Done();
 	}
 
 	if (Context->IsDone())
@@ -99,110 +94,126 @@ bool FPCGExWritePathExtrasElement::ExecuteInternal(FPCGContext* InContext) const
 	return Context->IsDone();
 }
 
-bool FPCGExWritePathExtrasTask::ExecuteTask()
+namespace PCGExWritePathExtras
 {
-	const FPCGExWritePathExtrasContext* Context = Manager->GetContext<FPCGExWritePathExtrasContext>();
-	PCGEX_SETTINGS(WritePathExtras)
+	FProcessor::~FProcessor()
+	{
+		PCGEX_FOREACH_FIELD_PATHEXTRAS(PCGEX_OUTPUT_DELETE)
+	}
 
-	const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
-	const int32 NumPoints = InPoints.Num();
-	TArray<FVector> Positions;
-	TArray<FVector> Normals;
+	bool FProcessor::Process(FPCGExAsyncManager* AsyncManager)
+	{
+		const FPCGExWritePathExtrasContext* Context = AsyncManager->GetContext<FPCGExWritePathExtrasContext>();
+		PCGEX_SETTINGS(WritePathExtras)
 
-	const FVector StaticUp = Settings->UpVector;
-	PCGEx::FLocalVectorGetter* Up = new PCGEx::FLocalVectorGetter();
+		PointIO->InitializeOutput(PCGExData::EInit::DuplicateInput);
+		PointIO->CreateInKeys();
 
-	if (Settings->bUseLocalUpVector)
-	{
-		Up->Capture(Settings->LocalUpVector);
-		Up->Grab(*PointIO);
-	}
+		PCGEX_FOREACH_FIELD_PATHEXTRAS(PCGEX_OUTPUT_LOCAL_INIT)
 
-	Positions.SetNum(NumPoints);
-	Normals.SetNum(NumPoints);
+		const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
+		const int32 NumPoints = InPoints.Num();
+		TArray<FVector> Positions;
+		TArray<FVector> Normals;
 
-	for (int i = 0; i < NumPoints; i++) { Positions[i] = InPoints[i].Transform.GetLocation(); }
+		const FVector StaticUp = Settings->UpVector;
+		PCGEx::FLocalVectorGetter* Up = new PCGEx::FLocalVectorGetter();
 
-	auto NRM = [&](const int32 A, const int32 B, const int32 C)-> FVector
-	{
-		const FVector VA = Positions[A];
-		const FVector VB = Positions[B];
-		const FVector VC = Positions[C];
-		const FVector UpAverage = ((Up->SafeGet(A, StaticUp) + Up->SafeGet(B, StaticUp) + Up->SafeGet(C, StaticUp)) / 3).GetSafeNormal();
-		return FMath::Lerp(PCGExMath::GetNormal(VA, VB, VB + UpAverage), PCGExMath::GetNormal(VB, VC, VC + UpAverage), 0.5).GetSafeNormal();
-	};
+		if (Settings->bUseLocalUpVector)
+		{
+			Up->Capture(Settings->LocalUpVector);
+			Up->Grab(*PointIO);
+		}
 
-	PCGExMath::FPathMetrics Metrics = PCGExMath::FPathMetrics(Positions[0]);
+		Positions.SetNum(NumPoints);
+		Normals.SetNum(NumPoints);
 
-	const int32 LastIndex = NumPoints - 1;
-	FVector PathCentroid = FVector::ZeroVector;
+		for (int i = 0; i < NumPoints; i++) { Positions[i] = InPoints[i].Transform.GetLocation(); }
 
-	PCGEX_OUTPUT_VALUE(DirectionToNext, 0, (Positions[0] - Positions[1]).GetSafeNormal());
-	PCGEX_OUTPUT_VALUE(DirectionToPrev, 0, (Positions[1] - Positions[0]).GetSafeNormal());
-	PCGEX_OUTPUT_VALUE(DistanceToStart, 0, 0);
+		auto NRM = [&](const int32 A, const int32 B, const int32 C)-> FVector
+		{
+			const FVector VA = Positions[A];
+			const FVector VB = Positions[B];
+			const FVector VC = Positions[C];
+			const FVector UpAverage = ((Up->SafeGet(A, StaticUp) + Up->SafeGet(B, StaticUp) + Up->SafeGet(C, StaticUp)) / 3).GetSafeNormal();
+			return FMath::Lerp(PCGExMath::GetNormal(VA, VB, VB + UpAverage), PCGExMath::GetNormal(VB, VC, VC + UpAverage), 0.5).GetSafeNormal();
+		};
 
-	PCGEX_OUTPUT_VALUE(DistanceToNext, 0, FVector::Dist(Positions[0], Positions[1]));
-	PCGEX_OUTPUT_VALUE(DistanceToPrev, 0, 0);
+		PCGExMath::FPathMetrics Metrics = PCGExMath::FPathMetrics(Positions[0]);
 
-	FVector PathDir = (Positions[0] - Positions[1]);
+		const int32 LastIndex = NumPoints - 1;
+		FVector PathCentroid = FVector::ZeroVector;
 
-	for (int i = 1; i < LastIndex; i++)
-	{
-		const double TraversedDistance = Metrics.Add(Positions[i]);
-		PCGEX_OUTPUT_VALUE(PointNormal, i, NRM(i - 1, i, i + 1));
-		PCGEX_OUTPUT_VALUE(DirectionToNext, i, (Positions[i] - Positions[i+1]).GetSafeNormal());
-		PCGEX_OUTPUT_VALUE(DirectionToPrev, i, (Positions[i-1] - Positions[i]).GetSafeNormal());
-		PCGEX_OUTPUT_VALUE(DistanceToStart, i, TraversedDistance);
+		PCGEX_OUTPUT_LOCAL_VALUE(DirectionToNext, 0, (Positions[0] - Positions[1]).GetSafeNormal());
+		PCGEX_OUTPUT_LOCAL_VALUE(DirectionToPrev, 0, (Positions[1] - Positions[0]).GetSafeNormal());
+		PCGEX_OUTPUT_LOCAL_VALUE(DistanceToStart, 0, 0);
 
-		PCGEX_OUTPUT_VALUE(DistanceToNext, i, FVector::Dist(Positions[i],Positions[i+1]));
-		PCGEX_OUTPUT_VALUE(DistanceToPrev, i, FVector::Dist(Positions[i-1],Positions[i]));
+		PCGEX_OUTPUT_LOCAL_VALUE(DistanceToNext, 0, FVector::Dist(Positions[0], Positions[1]));
+		PCGEX_OUTPUT_LOCAL_VALUE(DistanceToPrev, 0, 0);
 
-		PathDir += (Positions[i] - Positions[i + 1]);
-	}
+		FVector PathDir = (Positions[0] - Positions[1]);
+
+		for (int i = 1; i < LastIndex; i++)
+		{
+			const double TraversedDistance = Metrics.Add(Positions[i]);
+			PCGEX_OUTPUT_LOCAL_VALUE(PointNormal, i, NRM(i - 1, i, i + 1));
+			PCGEX_OUTPUT_LOCAL_VALUE(DirectionToNext, i, (Positions[i] - Positions[i+1]).GetSafeNormal());
+			PCGEX_OUTPUT_LOCAL_VALUE(DirectionToPrev, i, (Positions[i-1] - Positions[i]).GetSafeNormal());
+			PCGEX_OUTPUT_LOCAL_VALUE(DistanceToStart, i, TraversedDistance);
 
-	Metrics.Add(Positions[LastIndex]);
+			PCGEX_OUTPUT_LOCAL_VALUE(DistanceToNext, i, FVector::Dist(Positions[i],Positions[i+1]));
+			PCGEX_OUTPUT_LOCAL_VALUE(DistanceToPrev, i, FVector::Dist(Positions[i-1],Positions[i]));
 
-	PCGEX_OUTPUT_VALUE(DirectionToNext, LastIndex, (Positions[LastIndex-1] - Positions[LastIndex]).GetSafeNormal());
-	PCGEX_OUTPUT_VALUE(DirectionToPrev, LastIndex, (Positions[LastIndex] - Positions[LastIndex-1]).GetSafeNormal());
-	PCGEX_OUTPUT_VALUE(DistanceToStart, LastIndex, Metrics.Length);
+			PathDir += (Positions[i] - Positions[i + 1]);
+		}
 
-	PCGEX_OUTPUT_VALUE(DistanceToNext, LastIndex, 0);
-	PCGEX_OUTPUT_VALUE(DistanceToPrev, LastIndex, FVector::Dist(Positions[LastIndex-1],Positions[LastIndex]));
+		Metrics.Add(Positions[LastIndex]);
 
-	if (Settings->bClosedPath)
-	{
-		PCGEX_OUTPUT_VALUE(DirectionToPrev, 0, (Positions[0] - Positions[LastIndex]).GetSafeNormal());
-		PCGEX_OUTPUT_VALUE(DirectionToNext, LastIndex, (Positions[LastIndex] - Positions[0]).GetSafeNormal());
+		PCGEX_OUTPUT_LOCAL_VALUE(DirectionToNext, LastIndex, (Positions[LastIndex-1] - Positions[LastIndex]).GetSafeNormal());
+		PCGEX_OUTPUT_LOCAL_VALUE(DirectionToPrev, LastIndex, (Positions[LastIndex] - Positions[LastIndex-1]).GetSafeNormal());
+		PCGEX_OUTPUT_LOCAL_VALUE(DistanceToStart, LastIndex, Metrics.Length);
 
-		PCGEX_OUTPUT_VALUE(DistanceToNext, LastIndex, FVector::Dist(Positions[LastIndex], Positions[0]));
-		PCGEX_OUTPUT_VALUE(DistanceToPrev, 0, FVector::Dist(Positions[0], Positions[LastIndex]));
+		PCGEX_OUTPUT_LOCAL_VALUE(DistanceToNext, LastIndex, 0);
+		PCGEX_OUTPUT_LOCAL_VALUE(DistanceToPrev, LastIndex, FVector::Dist(Positions[LastIndex-1],Positions[LastIndex]));
 
-		PCGEX_OUTPUT_VALUE(PointNormal, 0, NRM(LastIndex, 0, 1));
-		PCGEX_OUTPUT_VALUE(PointNormal, LastIndex, NRM(NumPoints - 2, LastIndex, 0));
-	}
-	else
-	{
-		PCGEX_OUTPUT_VALUE(PointNormal, 0, NRM(0, 0, 1));
-		PCGEX_OUTPUT_VALUE(PointNormal, LastIndex, NRM(NumPoints - 2, LastIndex, LastIndex));
-	}
+		if (Settings->bClosedPath)
+		{
+			PCGEX_OUTPUT_LOCAL_VALUE(DirectionToPrev, 0, (Positions[0] - Positions[LastIndex]).GetSafeNormal());
+			PCGEX_OUTPUT_LOCAL_VALUE(DirectionToNext, LastIndex, (Positions[LastIndex] - Positions[0]).GetSafeNormal());
 
-	PCGExMath::FPathMetrics SecondMetrics = PCGExMath::FPathMetrics(Positions[0]);
+			PCGEX_OUTPUT_LOCAL_VALUE(DistanceToNext, LastIndex, FVector::Dist(Positions[LastIndex], Positions[0]));
+			PCGEX_OUTPUT_LOCAL_VALUE(DistanceToPrev, 0, FVector::Dist(Positions[0], Positions[LastIndex]));
 
-	for (int i = 0; i < NumPoints; i++)
-	{
-		const double TraversedDistance = SecondMetrics.Add(Positions[i]);
-		PCGEX_OUTPUT_VALUE(PointTime, i, TraversedDistance / Metrics.Length);
-		PCGEX_OUTPUT_VALUE(DistanceToEnd, i, Metrics.Length - TraversedDistance);
-		PathCentroid += Positions[i];
-	}
+			PCGEX_OUTPUT_LOCAL_VALUE(PointNormal, 0, NRM(LastIndex, 0, 1));
+			PCGEX_OUTPUT_LOCAL_VALUE(PointNormal, LastIndex, NRM(NumPoints - 2, LastIndex, 0));
+		}
+		else
+		{
+			PCGEX_OUTPUT_LOCAL_VALUE(PointNormal, 0, NRM(0, 0, 1));
+			PCGEX_OUTPUT_LOCAL_VALUE(PointNormal, LastIndex, NRM(NumPoints - 2, LastIndex, LastIndex));
+		}
 
-	UPCGMetadata* Meta = PointIO->GetOut()->Metadata;
+		PCGExMath::FPathMetrics SecondMetrics = PCGExMath::FPathMetrics(Positions[0]);
 
-	if (Context->bWritePathLength) { PCGExData::WriteMark(Meta, Settings->PathLengthAttributeName, Metrics.Length); }
-	if (Context->bWritePathDirection) { PCGExData::WriteMark(Meta, Settings->PathDirectionAttributeName, (PathDir / NumPoints).GetSafeNormal()); }
-	if (Context->bWritePathCentroid) { PCGExData::WriteMark(Meta, Settings->PathCentroidAttributeName, (PathCentroid / NumPoints).GetSafeNormal()); }
+		for (int i = 0; i < NumPoints; i++)
+		{
+			const double TraversedDistance = SecondMetrics.Add(Positions[i]);
+			PCGEX_OUTPUT_LOCAL_VALUE(PointTime, i, TraversedDistance / Metrics.Length);
+			PCGEX_OUTPUT_LOCAL_VALUE(DistanceToEnd, i, Metrics.Length - TraversedDistance);
+			PathCentroid += Positions[i];
+		}
 
-	return true;
+		UPCGMetadata* Meta = PointIO->GetOut()->Metadata;
+
+		if (Context->bWritePathLength) { PCGExData::WriteMark(Meta, Settings->PathLengthAttributeName, Metrics.Length); }
+		if (Context->bWritePathDirection) { PCGExData::WriteMark(Meta, Settings->PathDirectionAttributeName, (PathDir / NumPoints).GetSafeNormal()); }
+		if (Context->bWritePathCentroid) { PCGExData::WriteMark(Meta, Settings->PathCentroidAttributeName, (PathCentroid / NumPoints).GetSafeNormal()); }
+
+		PCGEX_FOREACH_FIELD_PATHEXTRAS(PCGEX_OUTPUT_LOCAL_WRITE)
+		PCGEX_DELETE(Up)
+
+		return true;
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
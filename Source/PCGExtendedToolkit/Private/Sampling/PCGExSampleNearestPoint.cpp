@@ -168,36 +168,30 @@ bool FPCGExSampleNearestPointElement::ExecuteInternal(FPCGContext* InContext) co
 
 	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
-		auto Initialize = [&](PCGExData::FPointIO& PointIO)
+		PCGExData::FPointIO& PointIO = *Context->CurrentIO;
+
+		if (Context->bUseLocalRangeMin)
 		{
-			if (Context->bUseLocalRangeMin)
-			{
-				if (Context->RangeMinGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMin metadata missing")); }
-			}
+			if (Context->RangeMinGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMin metadata missing")); }
+		}
 
-			if (Context->bUseLocalRangeMax)
-			{
-				if (Context->RangeMaxGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMax metadata missing")); }
-			}
+		if (Context->bUseLocalRangeMax)
+		{
+			if (Context->RangeMaxGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMax metadata missing")); }
+		}
 
-			if (Settings->bWriteLookAtTransform)
+		if (Settings->bWriteLookAtTransform)
+		{
+			if (Settings->LookAtUpSelection == EPCGExSampleSource::Source &&
+				!Context->LookAtUpGetter.Grab(PointIO))
 			{
-				if (Settings->LookAtUpSelection == EPCGExSampleSource::Source &&
-					!Context->LookAtUpGetter.Grab(PointIO))
-				{
-					PCGE_LOG(Warning, GraphAndLog, FTEXT("LookUp is invalid on source."));
-				}
+				PCGE_LOG(Warning, GraphAndLog, FTEXT("LookUp is invalid on source."));
 			}
+		}
 
-			PCGEX_FOREACH_FIELD_NEARESTPOINT(PCGEX_OUTPUT_ACCESSOR_INIT)
-		};
-
-		auto ProcessPoint = [&](const int32 ReadIndex, const PCGExData::FPointIO& PointIO)
-		{
-			Context->GetAsyncManager()->Start<FPCGExSamplePointTask>(ReadIndex, const_cast<PCGExData::FPointIO*>(&PointIO));
-		};
+		PCGEX_FOREACH_FIELD_NEARESTPOINT(PCGEX_OUTPUT_ACCESSOR_INIT)
 
-		if (!Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { return false; }
+		Context->GetAsyncManager()->StartRanges<FPCGExSamplePointTask>(PointIO.GetNum(), Context->ChunkSize, &PointIO);
 		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
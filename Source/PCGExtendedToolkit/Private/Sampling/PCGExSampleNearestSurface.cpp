@@ -89,7 +89,7 @@ bool FPCGExSampleNearestSurfaceElement::ExecuteInternal(FPCGContext* InContext)
 
 			PCGEX_FOREACH_FIELD_NEARESTSURFACE(PCGEX_OUTPUT_ACCESSOR_INIT)
 
-			for (int i = 0; i < PointIO.GetNum(); i++) { Context->GetAsyncManager()->Start<FSweepSphereTask>(i, Context->CurrentIO); }
+			Context->GetAsyncManager()->StartRanges<FSweepSphereTask>(PointIO.GetNum(), Context->ChunkSize, Context->CurrentIO);
 			Context->SetAsyncState(PCGExMT::State_ProcessingPoints);
 		}
 	}
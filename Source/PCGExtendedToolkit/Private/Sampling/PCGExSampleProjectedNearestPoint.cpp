@@ -234,27 +234,21 @@ bool FPCGExSampleProjectedNearestPointElement::ExecuteInternal(FPCGContext* InCo
 
 	if (Context->IsState(PCGExMT::State_ProcessingPoints))
 	{
-		auto Initialize = [&](PCGExData::FPointIO& PointIO)
-		{
-			if (Context->bUseLocalRangeMin)
-			{
-				if (Context->RangeMinGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMin metadata missing")); }
-			}
+		PCGExData::FPointIO& PointIO = *Context->CurrentIO;
 
-			if (Context->bUseLocalRangeMax)
-			{
-				if (Context->RangeMaxGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMax metadata missing")); }
-			}
-
-			PCGEX_FOREACH_FIELD_PROJECTNEARESTPOINT(PCGEX_OUTPUT_ACCESSOR_INIT)
-		};
+		if (Context->bUseLocalRangeMin)
+		{
+			if (Context->RangeMinGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMin metadata missing")); }
+		}
 
-		auto ProcessPoint = [&](const int32 ReadIndex, const PCGExData::FPointIO& PointIO)
+		if (Context->bUseLocalRangeMax)
 		{
-			Context->GetAsyncManager()->Start<FPCGExSampleProjectedPointTask>(ReadIndex, const_cast<PCGExData::FPointIO*>(&PointIO));
-		};
+			if (Context->RangeMaxGetter.Grab(PointIO)) { PCGE_LOG(Warning, GraphAndLog, FTEXT("RangeMax metadata missing")); }
+		}
 
-		if (!Context->ProcessCurrentPoints(Initialize, ProcessPoint)) { return false; }
+		PCGEX_FOREACH_FIELD_PROJECTNEARESTPOINT(PCGEX_OUTPUT_ACCESSOR_INIT)
+
+		Context->GetAsyncManager()->StartRanges<FPCGExSampleProjectedPointTask>(PointIO.GetNum(), Context->ChunkSize, &PointIO);
 		Context->SetAsyncState(PCGExMT::State_WaitingOnAsyncWork);
 	}
 
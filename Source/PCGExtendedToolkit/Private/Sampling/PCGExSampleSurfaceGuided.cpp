@@ -96,7 +96,7 @@ bool FPCGExSampleSurfaceGuidedElement::ExecuteInternal(FPCGContext* InContext) c
 
 			PCGEX_FOREACH_FIELD_SURFACEGUIDED(PCGEX_OUTPUT_ACCESSOR_INIT)
 
-			for (int i = 0; i < PointIO.GetNum(); i++) { Context->GetAsyncManager()->Start<FTraceTask>(i, Context->CurrentIO); }
+			Context->GetAsyncManager()->StartRanges<FTraceTask>(PointIO.GetNum(), Context->ChunkSize, Context->CurrentIO);
 			Context->SetAsyncState(PCGExMT::State_ProcessingPoints);
 		}
 	}
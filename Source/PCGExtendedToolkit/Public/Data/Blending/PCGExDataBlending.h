@@ -385,6 +385,19 @@ namespace PCGExDataBlending
 
 namespace PCGExDataBlendingTask
 {
+	/** Blends each compound's source points into the output point of the same index. */
+	PCGEXTENDEDTOOLKIT_API void BlendCompoundedIO(
+		PCGExData::FPointIO* SourceIO,
+		PCGExData::FPointIO* TargetIO,
+		FPCGExBlendingSettings* BlendingSettings,
+		PCGExData::FIdxCompoundList* CompoundList,
+		const FPCGExDistanceSettings& DistSettings);
+
+	PCGEXTENDEDTOOLKIT_API bool WriteFuseMetadata(
+		PCGExData::FPointIO* TargetIO,
+		const PCGExGraph::FGraphMetadataSettings* MetadataSettings,
+		const PCGExData::FIdxCompoundList* CompoundList);
+
 	class PCGEXTENDEDTOOLKIT_API FBlendCompoundedIO : public FPCGExNonAbandonableTask
 	{
 	public:
@@ -11,6 +11,7 @@
 
 #include "PCGEx.h"
 #include "PCGExMath.h"
+#include "PCGExMT.h"
 #include "PCGExPointIO.h"
 #include "Metadata/Accessors/PCGAttributeAccessor.h"
 
@@ -477,7 +478,7 @@ namespace PCGEx
 		EPCGExAxis Axis = EPCGExAxis::Forward;
 		EPCGExSingleField Field = EPCGExSingleField::X;
 
-		TArray<T> Values;
+		TArrayView<const T> Values;
 		mutable T Min = T{};
 		mutable T Max = T{};
 
@@ -494,7 +495,26 @@ namespace PCGEx
 
 		virtual void Cleanup()
 		{
-			Values.Empty();
+			Values = TArrayView<const T>();
+			Column.Reset();
+			bOwnsColumn = false;
+		}
+
+		/**
+		 * Values are borrowed from a column that may be shared with other getters;
+		 * this detaches them into a private copy that can be safely written to.
+		 */
+		TArray<T>& GetMutableValues()
+		{
+			if (!bOwnsColumn)
+			{
+				const TSharedPtr<PCGExData::TColumn<T>> OwnColumn = MakeShared<PCGExData::TColumn<T>>();
+				OwnColumn->Values.Append(Values.GetData(), Values.Num());
+				Column = OwnColumn;
+				Values = Column->Values;
+				bOwnsColumn = true;
+			}
+			return Column->Values;
 		}
 
 		/**
@@ -507,7 +527,7 @@ namespace PCGEx
 			Cleanup();
 
 			ResetMinMax();
-			bMinMaxDirty = !bCaptureMinMax;
+			bMinMaxDirty = true;
 			bNormalized = false;
 
 			bValid = false;
@@ -521,69 +541,76 @@ namespace PCGEx
 
 			ProcessExtraNames(ExtraNames);
 
-			int32 NumPoints = PointIO.GetNum();
+			const int32 NumPoints = PointIO.GetNum();
 			Selection = Selector.GetSelection();
+
 			if (Selection == EPCGAttributePropertySelection::Attribute)
 			{
 				Attribute = InData->Metadata->GetMutableAttribute(Selector.GetName());
 				if (!Attribute) { return false; }
+			}
+			else if (Selection != EPCGAttributePropertySelection::PointProperty)
+			{
+				//TODO: Support extra properties
+				return false;
+			}
+
+			const bool bCacheable = PointIO.CanCacheColumns();
+			const FString ColumnKey = bCacheable ? GetColumnKey(Selector) : FString();
+
+			if (bCacheable)
+			{
+				if (const TSharedPtr<PCGExData::FColumn> Cached = PointIO.FindColumn(ColumnKey))
+				{
+					Column = StaticCastSharedPtr<PCGExData::TColumn<T>>(Cached);
+					Values = Column->Values;
+					bValid = true;
+					if (bCaptureMinMax) { UpdateMinMax(); }
+					return bValid;
+				}
+			}
+
+			const TSharedPtr<PCGExData::TColumn<T>> NewColumn = MakeShared<PCGExData::TColumn<T>>();
+			TArray<T>& OutValues = NewColumn->Values;
+			if constexpr (TIsTriviallyDestructible<T>::Value) { OutValues.SetNumUninitialized(NumPoints); }
+			else { OutValues.SetNum(NumPoints); }
 
+			if (Selection == EPCGAttributePropertySelection::Attribute)
+			{
 				PCGMetadataAttribute::CallbackWithRightType(
 					Attribute->GetTypeId(),
 					[&](auto DummyValue) -> void
 					{
 						using RawT = decltype(DummyValue);
-						TArray<RawT> RawValues;
 
-						RawValues.SetNumUninitialized(NumPoints);
-						Values.SetNumUninitialized(NumPoints);
+						const FPCGMetadataAttribute<RawT>* TypedAttribute = InData->Metadata->GetConstTypedAttribute<RawT>(Selector.GetName());
+						const FPCGAttributeAccessor<RawT> Accessor(TypedAttribute, InData->Metadata);
+						const IPCGAttributeAccessorKeys* Keys = const_cast<PCGExData::FPointIO&>(PointIO).CreateInKeys();
 
-						FPCGMetadataAttribute<RawT>* TypedAttribute = InData->Metadata->GetMutableTypedAttribute<RawT>(Selector.GetName());
-						FPCGAttributeAccessor<RawT>* Accessor = new FPCGAttributeAccessor<RawT>(TypedAttribute, InData->Metadata);
-						IPCGAttributeAccessorKeys* Keys = const_cast<PCGExData::FPointIO&>(PointIO).CreateInKeys();
-						TArrayView<RawT> View(RawValues);
-						Accessor->GetRange(View, 0, *Keys, PCGEX_AAFLAG);
-
-						if (bCaptureMinMax)
-						{
-							for (int i = 0; i < NumPoints; i++)
+						ConvertChunked<RawT>(
+							OutValues, bCaptureMinMax,
+							[&](const int32 Start, const int32 Count, RawT* OutRaw)
 							{
-								T V = Convert(RawValues[i]);
-								Min = PCGExMath::Min(V, Min);
-								Max = PCGExMath::Max(V, Max);
-								Values[i] = V;
-							}
-						}
-						else
-						{
-							for (int i = 0; i < NumPoints; i++) { Values[i] = Convert(RawValues[i]); }
-						}
-
-						RawValues.Empty();
-						delete Accessor;
+								TArrayView<RawT> View(OutRaw, Count);
+								Accessor.GetRange(View, Start, *Keys, PCGEX_AAFLAG);
+							});
 					});
-
-				bValid = true;
 			}
-			else if (Selection == EPCGAttributePropertySelection::PointProperty)
+			else
 			{
-				const TUniquePtr<const IPCGAttributeAccessor> Accessor = PCGAttributeAccessorHelpers::CreateConstAccessor(InData, Selector);
 				const TArray<FPCGPoint>& InPoints = InData->GetPoints();
-				Values.SetNumUninitialized(NumPoints);
 #define PCGEX_GET_BY_ACCESSOR(_ENUM, _ACCESSOR) case _ENUM:\
-				if (bCaptureMinMax) { for (int i = 0; i < NumPoints; i++) {\
-						T V = Convert(InPoints[i]._ACCESSOR); Min = PCGExMath::Min(V, Min); Max = PCGExMath::Max(V, Max); Values[i] = V;\
-					} } else { for (int i = 0; i < NumPoints; i++) { Values[i] = Convert(InPoints[i]._ACCESSOR); } } break;
+				ConvertChunked<typename TDecay<decltype(InPoints[0]._ACCESSOR)>::Type>(\
+					OutValues, bCaptureMinMax, [&](const int32 Start, const int32 Count, auto* OutRaw){ for (int i = 0; i < Count; i++) { OutRaw[i] = InPoints[Start + i]._ACCESSOR; } }); break;
 
 				switch (Descriptor.Selector.GetPointProperty()) { PCGEX_FOREACH_POINTPROPERTY(PCGEX_GET_BY_ACCESSOR) }
 #undef PCGEX_GET_BY_ACCESSOR
-				bValid = true;
-			}
-			else
-			{
-				//TODO: Support extra properties
 			}
 
+			Column = bCacheable ? StaticCastSharedPtr<PCGExData::TColumn<T>>(PointIO.AddColumn(ColumnKey, NewColumn)) : NewColumn;
+			Values = Column->Values;
+			bValid = true;
+
 			return bValid;
 		}
 
@@ -628,11 +655,26 @@ namespace PCGEx
 			if (!bMinMaxDirty) { return; }
 			ResetMinMax();
 			bMinMaxDirty = false;
-			for (int i = 0; i < Values.Num(); i++)
+
+			const int32 NumValues = Values.Num();
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumValues, ConvertChunkSize);
+
+			TArray<T> ChunkMin;
+			TArray<T> ChunkMax;
+			ChunkMin.Init(Min, NumChunks);
+			ChunkMax.Init(Max, NumChunks);
+
+			PCGExMT::ParallelFor(
+				NumChunks, PCGExMT::GetNumPoolWorkers(), [&](const int32 ChunkIndex)
+				{
+					const int32 Start = ChunkIndex * ConvertChunkSize;
+					ReduceMinMax(Values.GetData() + Start, FMath::Min(ConvertChunkSize, NumValues - Start), ChunkMin[ChunkIndex], ChunkMax[ChunkIndex]);
+				});
+
+			for (int i = 0; i < NumChunks; i++)
 			{
-				T V = Values[i];
-				Min = PCGExMath::Min(V, Min);
-				Max = PCGExMath::Max(V, Max);
+				Min = PCGExMath::Min(ChunkMin[i], Min);
+				Max = PCGExMath::Max(ChunkMax[i], Max);
 			}
 		}
 
@@ -642,7 +684,8 @@ namespace PCGEx
 			bNormalized = true;
 			UpdateMinMax();
 			T Range = PCGExMath::Sub(Max, Min);
-			for (int i = 0; i < Values.Num(); i++) { Values[i] = PCGExMath::Div(Values[i], Range); }
+			TArray<T>& MutableValues = GetMutableValues();
+			for (int i = 0; i < MutableValues.Num(); i++) { MutableValues[i] = PCGExMath::Div(MutableValues[i], Range); }
 		}
 
 		T SoftGet(const FPCGPoint& Point, const T& fallback)
@@ -680,6 +723,92 @@ namespace PCGEx
 		virtual void Capture(const FPCGAttributePropertyInputSelector& InDescriptor) { Capture(FPCGExInputDescriptor(InDescriptor)); }
 
 	protected:
+		TSharedPtr<PCGExData::TColumn<T>> Column;
+		bool bOwnsColumn = false;
+
+		static constexpr int32 ConvertChunkSize = PCGExMT::GParallelForMaxChunk;
+
+		static void ReduceMinMax(const T* InValues, const int32 Count, T& OutMin, T& OutMax)
+		{
+			T LocalMin = OutMin;
+			T LocalMax = OutMax;
+			for (int i = 0; i < Count; i++)
+			{
+				LocalMin = PCGExMath::Min(InValues[i], LocalMin);
+				LocalMax = PCGExMath::Max(InValues[i], LocalMax);
+			}
+			OutMin = LocalMin;
+			OutMax = LocalMax;
+		}
+
+		/**
+		 * Fills OutValues chunk by chunk : each chunk fetches its raw values, converts them with a single
+		 * ConvertRange call and reduces its own Min/Max while the values are still hot.
+		 * Same-type conversions are treated as identity : raw values are then fetched straight into the output.
+		 * @tparam RawT Source type
+		 * @param OutValues Sized output
+		 * @param bCaptureMinMax
+		 * @param Fetch (Start, Count, RawT* OutRaw) writes Count raw values starting at Start
+		 */
+		template <typename RawT, typename FetchFunc>
+		void ConvertChunked(TArray<T>& OutValues, const bool bCaptureMinMax, FetchFunc&& Fetch)
+		{
+			const int32 NumValues = OutValues.Num();
+			const int32 NumChunks = FMath::DivideAndRoundUp(NumValues, ConvertChunkSize);
+
+			TArray<T> ChunkMin;
+			TArray<T> ChunkMax;
+			if (bCaptureMinMax)
+			{
+				ChunkMin.Init(Min, NumChunks);
+				ChunkMax.Init(Max, NumChunks);
+			}
+
+			PCGExMT::ParallelFor(
+				NumChunks, PCGExMT::GetNumPoolWorkers(), [&](const int32 ChunkIndex)
+				{
+					const int32 Start = ChunkIndex * ConvertChunkSize;
+					const int32 Count = FMath::Min(ConvertChunkSize, NumValues - Start);
+					T* OutChunk = OutValues.GetData() + Start;
+
+					if constexpr (std::is_same_v<RawT, T>) { Fetch(Start, Count, OutChunk); }
+					else
+					{
+						TArray<RawT> RawValues;
+						if constexpr (TIsTriviallyDestructible<RawT>::Value) { RawValues.SetNumUninitialized(Count); }
+						else { RawValues.SetNum(Count); }
+						Fetch(Start, Count, RawValues.GetData());
+						ConvertRange(RawValues.GetData(), OutChunk, Count);
+					}
+
+					if (bCaptureMinMax) { ReduceMinMax(OutChunk, Count, ChunkMin[ChunkIndex], ChunkMax[ChunkIndex]); }
+				});
+
+			if (!bCaptureMinMax) { return; }
+
+			for (int i = 0; i < NumChunks; i++)
+			{
+				Min = PCGExMath::Min(ChunkMin[i], Min);
+				Max = PCGExMath::Max(ChunkMax[i], Max);
+			}
+
+			bMinMaxDirty = false;
+		}
+
+		/**
+		 * Identifies the converted column : source, target type and every setting Convert depends on.
+		 */
+		FString GetColumnKey(const FPCGAttributePropertyInputSelector& Selector) const
+		{
+			const FString Source = Selection == EPCGAttributePropertySelection::Attribute ?
+				                       Selector.GetName().ToString() :
+				                       FString::Printf(TEXT("$%d"), static_cast<int32>(Descriptor.Selector.GetPointProperty()));
+			return FString::Printf(
+				TEXT("%s|%d|%d|%d|%d|%d"), *Source,
+				static_cast<int32>(PCG::Private::MetadataTypes<T>::Id),
+				static_cast<int32>(Component), bUseAxis, static_cast<int32>(Axis), static_cast<int32>(Field));
+		}
+
 		virtual void ProcessExtraNames(const TArray<FString>& ExtraNames)
 		{
 			if (GetAxisSelection(ExtraNames, Axis))
@@ -703,6 +832,13 @@ namespace PCGEx
 
 #define  PCGEX_PRINT_VIRTUAL(_TYPE, _NAME, ...) virtual T Convert(const _TYPE Value) const { return GetDefaultValue(); };
 		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_PRINT_VIRTUAL)
+
+		/**
+		 * Converts a contiguous range of raw values. Getters override these with PCGEX_CONVERT_RANGE so the
+		 * per-element Convert is statically bound & inlined instead of being dispatched once per value.
+		 */
+#define  PCGEX_PRINT_VIRTUAL_RANGE(_TYPE, _NAME, ...) virtual void ConvertRange(const _TYPE* InRaw, T* OutValues, const int32 Count) const { for (int i = 0; i < Count; i++) { OutValues[i] = Convert(InRaw[i]); } };
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_PRINT_VIRTUAL_RANGE)
 	};
 
 #pragma endregion
@@ -779,9 +915,18 @@ namespace PCGEx
 
 #pragma region Local Attribute Getter
 
+	/**
+	 * Statically bound ConvertRange overrides; expects the getter to pull its base Convert overloads in scope.
+	 * Classes deriving from a getter that override Convert again must re-declare these.
+	 */
+#define PCGEX_CONVERT_RANGE(_TYPE, _NAME, _CLASS, _VALUETYPE) virtual void ConvertRange(const _TYPE* InRaw, _VALUETYPE* OutValues, const int32 Count) const override { for (int i = 0; i < Count; i++) { OutValues[i] = _CLASS::Convert(InRaw[i]); } }
+
 	struct PCGEXTENDEDTOOLKIT_API FLocalSingleFieldGetter : public FAttributeGetter<double>
 	{
 	protected:
+		using FAttributeGetter<double>::Convert;
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERT_RANGE, FLocalSingleFieldGetter, double)
+
 		virtual void ResetMinMax() override
 		{
 			Min = TNumericLimits<double>::Max();
@@ -887,6 +1032,9 @@ namespace PCGEx
 	struct PCGEXTENDEDTOOLKIT_API FLocalIntegerGetter : public FAttributeGetter<int32>
 	{
 	protected:
+		using FAttributeGetter<int32>::Convert;
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERT_RANGE, FLocalIntegerGetter, int32)
+
 		virtual void ResetMinMax() override
 		{
 			Min = TNumericLimits<double>::Max();
@@ -992,6 +1140,9 @@ namespace PCGEx
 	struct PCGEXTENDEDTOOLKIT_API FLocalBoolGetter : public FAttributeGetter<bool>
 	{
 	protected:
+		using FAttributeGetter<bool>::Convert;
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERT_RANGE, FLocalBoolGetter, bool)
+
 		virtual void ResetMinMax() override
 		{
 			Min = false;
@@ -1097,6 +1248,9 @@ namespace PCGEx
 	struct PCGEXTENDEDTOOLKIT_API FLocalVectorGetter : public FAttributeGetter<FVector>
 	{
 	protected:
+		using FAttributeGetter<FVector>::Convert;
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERT_RANGE, FLocalVectorGetter, FVector)
+
 		virtual void ResetMinMax() override
 		{
 			Min = FVector(TNumericLimits<double>::Max());
@@ -1135,6 +1289,9 @@ namespace PCGEx
 	struct PCGEXTENDEDTOOLKIT_API FLocalToStringGetter : public FAttributeGetter<FString>
 	{
 	protected:
+		using FAttributeGetter<FString>::Convert;
+		PCGEX_FOREACH_SUPPORTEDTYPES(PCGEX_CONVERT_RANGE, FLocalToStringGetter, FString)
+
 		virtual void ResetMinMax() override
 		{
 			Min = TEXT("");
@@ -1158,6 +1315,8 @@ namespace PCGEx
 		virtual FString Convert(const FName Value) const override { return FString::Printf(TEXT("%s"), *Value.ToString()); }
 	};
 
+#undef PCGEX_CONVERT_RANGE
+
 #pragma endregion
 }
 
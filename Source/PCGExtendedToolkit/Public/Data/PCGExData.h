@@ -8,6 +8,7 @@
 #include "Blending/PCGExDataBlending.h"
 #include "Blending/PCGExDataBlendingOperations.h"
 #include "Data/PCGPointData.h"
+#include "Data/PCGSpatialData.h"
 #include "UObject/Object.h"
 
 #include "PCGExData.generated.h"
@@ -25,6 +26,43 @@ public:
 	virtual EPCGDataType GetDataType() const override { return EPCGDataType::Param; }
 };
 
+/**
+ * Subset of a parent point data, as a range of a shared index buffer.
+ * Owns its metadata (parented to the source one) but no points; these are only copied the first time
+ * a consumer asks for point data.
+ */
+UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
+class PCGEXTENDEDTOOLKIT_API UPCGExPointIndexViewData : public UPCGSpatialDataWithPointCache
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(const UPCGPointData* InSource, const TSharedPtr<const TArray<int32>>& InIndices, const int32 InStart, const int32 InCount);
+
+	int32 GetNumPoints() const { return Count; }
+
+	//~Begin UPCGSpatialData interface
+	virtual int GetDimension() const override { return 0; }
+	virtual FBox GetBounds() const override { return Bounds; }
+	virtual bool SamplePoint(const FTransform& Transform, const FBox& InBounds, FPCGPoint& OutPoint, UPCGMetadata* OutMetadata) const override;
+	//~End UPCGSpatialData interface
+
+	//~Begin UPCGSpatialDataWithPointCache interface
+	virtual const UPCGPointData* CreatePointData(FPCGContext* Context) const override;
+	//~End UPCGSpatialDataWithPointCache interface
+
+protected:
+	virtual UPCGSpatialData* CopyInternal() const override;
+
+	UPROPERTY()
+	TObjectPtr<const UPCGPointData> Source = nullptr;
+
+	TSharedPtr<const TArray<int32>> Indices;
+	int32 Start = 0;
+	int32 Count = 0;
+	FBox Bounds = FBox(ForceInit);
+};
+
 namespace PCGExData
 {
 	constexpr PCGExMT::AsyncState State_MergingData = __COUNTER__;
@@ -22,6 +22,22 @@ namespace PCGExData
 		Forward UMETA(DisplayName = "Forward Input Object")
 	};
 
+	/**
+	 * Type-erased, read-only attribute column shared by every getter reading the same input.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FColumn
+	{
+		virtual ~FColumn() = default;
+		virtual int64 GetAllocatedSize() const = 0;
+	};
+
+	template <typename T>
+	struct TColumn : public FColumn
+	{
+		TArray<T> Values;
+		virtual int64 GetAllocatedSize() const override { return Values.GetAllocatedSize(); }
+	};
+
 	/**
 	 * 
 	 */
@@ -36,6 +52,9 @@ namespace PCGExData
 		FPCGAttributeAccessorKeysPoints* InKeys = nullptr;
 		FPCGAttributeAccessorKeysPoints* OutKeys = nullptr;
 
+		mutable FRWLock ColumnsLock;
+		mutable TMap<FString, TSharedPtr<FColumn>> Columns;
+
 		const UPCGPointData* In;      // Input PointData	
 		UPCGPointData* Out = nullptr; // Output PointData
 
@@ -95,6 +114,26 @@ namespace PCGExData
 
 		FName DefaultOutputLabel = PCGEx::OutputPointsLabel;
 
+		/**
+		 * Columns are read from the input data and are only cached while that input cannot be written to,
+		 * i.e when it isn't forwarded as the output.
+		 */
+		bool CanCacheColumns() const { return RootIO ? RootIO->CanCacheColumns() : In && In != Out; }
+
+		/**
+		 * Find a cached column converted from the input data
+		 * @param Key Selection & conversion identifier
+		 */
+		TSharedPtr<FColumn> FindColumn(const FString& Key) const;
+
+		/**
+		 * Register a column converted from the input data.
+		 * If another reader registered the same key in the meantime, that column is returned instead.
+		 * @param Key Selection & conversion identifier
+		 * @param Column
+		 */
+		TSharedPtr<FColumn> AddColumn(const FString& Key, const TSharedPtr<FColumn>& Column) const;
+
 		const FPCGPoint& GetInPoint(const int32 Index) const { return In->GetPoints()[Index]; }
 		const FPCGPoint& GetOutPoint(const int32 Index) const { return Out->GetPoints()[Index]; }
 		FPCGPoint& GetMutablePoint(const int32 Index) const { return Out->GetMutablePoints()[Index]; }
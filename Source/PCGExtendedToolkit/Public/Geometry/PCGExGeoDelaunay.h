@@ -10,6 +10,154 @@
 
 namespace PCGExGeo
 {
+	static uint64 MortonSpread2(uint64 V)
+	{
+		V &= 0x3fffffff;
+		V = (V | V << 16) & 0x0000ffff0000ffff;
+		V = (V | V << 8) & 0x00ff00ff00ff00ff;
+		V = (V | V << 4) & 0x0f0f0f0f0f0f0f0f;
+		V = (V | V << 2) & 0x3333333333333333;
+		V = (V | V << 1) & 0x5555555555555555;
+		return V;
+	}
+
+	static uint64 MortonSpread3(uint64 V)
+	{
+		V &= 0xfffff;
+		V = (V | V << 32) & 0x1f00000000ffff;
+		V = (V | V << 16) & 0x1f0000ff0000ff;
+		V = (V | V << 8) & 0x100f00f00f00f00f;
+		V = (V | V << 4) & 0x10c30c30c30c30c3;
+		V = (V | V << 2) & 0x1249249249249249;
+		return V;
+	}
+
+	/**
+	 * Biased randomized insertion order (BRIO).
+	 * Points are spread over rounds of doubling size from a stable hash of their index, then sorted along a morton curve
+	 * within each round. Incremental triangulators keep their randomized guarantees while walking short distances
+	 * between consecutive insertions.
+	 * Keys are 4 bits of round followed by 60 bits of morton code, built with the given per-point callback.
+	 */
+	template <typename GetMortonFunc>
+	static void GetBRIOOrder(const int32 NumPoints, GetMortonFunc&& GetMorton, TArray<int32>& OutOrder)
+	{
+		constexpr int32 MaxLevel = 15;
+
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(NumPoints);
+		PCGEx::ArrayOfIndices(OutOrder, NumPoints);
+
+		PCGExMT::ParallelFor(
+			NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				const uint32 Level = FMath::Min(FMath::CountTrailingZeros(MurmurFinalize32(i) | (1u << MaxLevel)), static_cast<uint32>(MaxLevel));
+				Keys[i] = static_cast<uint64>(MaxLevel - Level) << 60 | GetMorton(i);
+			});
+
+		PCGEx::RadixSort(Keys, OutOrder);
+	}
+
+	static void GetBRIOOrder(const TArray<FVector2D>& Positions, TArray<int32>& OutOrder)
+	{
+		FBox2D Bounds = FBox2D(ForceInit);
+		for (const FVector2D& P : Positions) { Bounds += P; }
+
+		constexpr double AxisMax = (1 << 30) - 1;
+		const FVector2D Scale = FVector2D(AxisMax) / FVector2D::Max(Bounds.GetSize(), FVector2D(UE_SMALL_NUMBER));
+
+		GetBRIOOrder(
+			Positions.Num(), [&](const int32 i)
+			{
+				const FVector2D Local = (Positions[i] - Bounds.Min) * Scale;
+				return MortonSpread2(static_cast<uint64>(Local.X)) | MortonSpread2(static_cast<uint64>(Local.Y)) << 1;
+			}, OutOrder);
+	}
+
+	static void GetBRIOOrder(const TArrayView<FVector>& Positions, TArray<int32>& OutOrder)
+	{
+		FBox Bounds = FBox(ForceInit);
+		for (const FVector& P : Positions) { Bounds += P; }
+
+		constexpr double AxisMax = (1 << 20) - 1;
+		const FVector Scale = FVector(AxisMax) / Bounds.GetSize().ComponentMax(FVector(UE_SMALL_NUMBER));
+
+		GetBRIOOrder(
+			Positions.Num(), [&](const int32 i)
+			{
+				const FVector Local = (Positions[i] - Bounds.Min) * Scale;
+				return MortonSpread3(static_cast<uint64>(Local.X)) | MortonSpread3(static_cast<uint64>(Local.Y)) << 1 | MortonSpread3(static_cast<uint64>(Local.Z)) << 2;
+			}, OutOrder);
+	}
+
+	/**
+	 * Positive when D lies inside the circumcircle of A, B, C wound counter-clockwise.
+	 * Results within rounding noise of the determinant's permanent are flattened to zero.
+	 */
+	static double InCircle(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+	{
+		const FVector2D AD = A - D;
+		const FVector2D BD = B - D;
+		const FVector2D CD = C - D;
+
+		const double ALift = AD.SizeSquared();
+		const double BLift = BD.SizeSquared();
+		const double CLift = CD.SizeSquared();
+
+		const double Det =
+			ALift * (BD.X * CD.Y - CD.X * BD.Y) +
+			BLift * (CD.X * AD.Y - AD.X * CD.Y) +
+			CLift * (AD.X * BD.Y - BD.X * AD.Y);
+
+		const double Permanent =
+			ALift * (FMath::Abs(BD.X * CD.Y) + FMath::Abs(CD.X * BD.Y)) +
+			BLift * (FMath::Abs(CD.X * AD.Y) + FMath::Abs(AD.X * CD.Y)) +
+			CLift * (FMath::Abs(AD.X * BD.Y) + FMath::Abs(BD.X * AD.Y));
+
+		return FMath::Abs(Det) <= Permanent * 1e-12 ? 0 : Det;
+	}
+
+	/** Signed volume (x6) of A, B, C, D; positive when D lies below the plane of A, B, C wound counter-clockwise. */
+	static double Orient3(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+	{
+		return FVector::DotProduct(A - D, FVector::CrossProduct(B - D, C - D));
+	}
+
+	/**
+	 * Positive when E lies inside the circumsphere of A, B, C, D, given Orient3(A, B, C, D) is positive.
+	 * Results within rounding noise of the determinant's permanent are flattened to zero.
+	 */
+	static double InSphere(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+	{
+		const FVector AE = A - E;
+		const FVector BE = B - E;
+		const FVector CE = C - E;
+		const FVector DE = D - E;
+
+		auto Minor = [](const FVector& X, const FVector& Y, const FVector& Z) { return FVector::DotProduct(X, FVector::CrossProduct(Y, Z)); };
+		auto Permanent = [](const FVector& X, const FVector& Y, const FVector& Z)
+		{
+			return FMath::Abs(X.X) * (FMath::Abs(Y.Y * Z.Z) + FMath::Abs(Y.Z * Z.Y)) +
+				FMath::Abs(X.Y) * (FMath::Abs(Y.X * Z.Z) + FMath::Abs(Y.Z * Z.X)) +
+				FMath::Abs(X.Z) * (FMath::Abs(Y.X * Z.Y) + FMath::Abs(Y.Y * Z.X));
+		};
+
+		const double ALift = AE.SizeSquared();
+		const double BLift = BE.SizeSquared();
+		const double CLift = CE.SizeSquared();
+		const double DLift = DE.SizeSquared();
+
+		const double Det =
+			DLift * Minor(AE, BE, CE) - CLift * Minor(AE, BE, DE) +
+			BLift * Minor(AE, CE, DE) - ALift * Minor(BE, CE, DE);
+
+		const double Bound =
+			DLift * Permanent(AE, BE, CE) + CLift * Permanent(AE, BE, DE) +
+			BLift * Permanent(AE, CE, DE) + ALift * Permanent(BE, CE, DE);
+
+		return FMath::Abs(Det) <= Bound * 1e-11 ? 0 : Det;
+	}
+
 	struct FDelaunaySite2
 	{
 	public:
@@ -28,17 +176,24 @@ namespace PCGExGeo
 		}
 	};
 
+	/**
+	 * Triangulates points in BRIO order, then extracts sites and edges in parallel.
+	 * DelaunayEdges is a sorted array of unique H64U edge hashes.
+	 * Once processed, sites can be repaired in place with edge flips after positions moved.
+	 */
 	class PCGEXTENDEDTOOLKIT_API TDelaunay2
 	{
 	public:
-		UE::Geometry::FDelaunay2* Triangulation = nullptr;
+		UE::Geometry::FDelaunay2* Triangulation = nullptr; // Vertex indices are in insertion order, not input order
 
 		TArray<FDelaunaySite2> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		TArray<uint64> DelaunayEdges;
 		TSet<int32> DelaunayHull;
 		bool IsValid = false;
 
+		double Winding = 1; // Sign of the sites orientation in projected space
+
 		TDelaunay2()
 		{
 		}
@@ -68,16 +223,22 @@ namespace PCGExGeo
 			TArray<FVector2D> Positions2D;
 			ProjectionSettings.Project(Positions, Positions2D);
 
+			TArray<int32> Order;
+			GetBRIOOrder(Positions2D, Order);
+
+			TArray<FVector2D> OrderedPositions;
+			OrderedPositions.SetNumUninitialized(Order.Num());
+			for (int i = 0; i < Order.Num(); i++) { OrderedPositions[i] = Positions2D[Order[i]]; }
+
 			Triangulation = new UE::Geometry::FDelaunay2();
 
-			if (!Triangulation->Triangulate(Positions2D))
+			if (!Triangulation->Triangulate(OrderedPositions))
 			{
-				Positions2D.Empty();
 				Clear();
 				return false;
 			}
 
-			Positions2D.Empty();
+			OrderedPositions.Empty();
 
 			IsValid = true;
 
@@ -87,52 +248,194 @@ namespace PCGExGeo
 			Triangulation->GetTrianglesAndAdjacency(Triangles, Adjacencies);
 
 			const int32 NumSites = Triangles.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
 
 			Sites.SetNumUninitialized(NumSites);
+			DelaunayEdges.SetNumUninitialized(NumSites * 3);
 
-			for (int i = 0; i < NumSites; i++)
-			{
-				FDelaunaySite2& Site = Sites[i] = FDelaunaySite2(Triangles[i], Adjacencies[i], i);
-
-				for (int a = 0; a < 3; a++)
+			PCGExMT::ParallelFor(
+				NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
 				{
-					for (int b = a + 1; b < 3; b++)
-					{
-						const uint64 H = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]);
-						DelaunayEdges.Add(H);
+					const UE::Geometry::FIndex3i& Tri = Triangles[i];
+					FDelaunaySite2& Site = Sites[i] = FDelaunaySite2(UE::Geometry::FIndex3i(Order[Tri.A], Order[Tri.B], Order[Tri.C]), Adjacencies[i], i);
 
-						if (Site.Neighbors[b] == -1)
-						{
-							Site.bOnHull = true;
-						}
-					}
-
-					if (Site.Neighbors[a] == -1)
+					for (int a = 0; a < 3; a++)
 					{
-						Site.bOnHull = true;
-						DelaunayHull.Add(Site.Vtx[a]);
-						DelaunayHull.Add(Site.Vtx[PCGExMath::Tile(a + 1, 0, 2)]);
+						DelaunayEdges[i * 3 + a] = PCGEx::H64U(Site.Vtx[a], Site.Vtx[(a + 1) % 3]);
+						if (Site.Neighbors[a] == -1) { Site.bOnHull = true; }
 					}
+				});
+
+			PCGEx::SortUnique(DelaunayEdges);
+
+			for (const FDelaunaySite2& Site : Sites)
+			{
+				if (!Site.bOnHull) { continue; }
+				for (int a = 0; a < 3; a++)
+				{
+					if (Site.Neighbors[a] != -1) { continue; }
+					DelaunayHull.Add(Site.Vtx[a]);
+					DelaunayHull.Add(Site.Vtx[PCGExMath::Tile(a + 1, 0, 2)]);
 				}
 			}
 
+			for (const FDelaunaySite2& Site : Sites)
+			{
+				const double Area = FVector2D::CrossProduct(Positions2D[Site.Vtx[1]] - Positions2D[Site.Vtx[0]], Positions2D[Site.Vtx[2]] - Positions2D[Site.Vtx[0]]);
+				if (Area == 0) { continue; }
+				Winding = Area > 0 ? 1 : -1;
+				break;
+			}
+
 			Triangles.Empty();
 			Adjacencies.Empty();
 
 			return IsValid;
 		}
 
-		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
+		/**
+		 * Restores the Delaunay property of Sites after Positions moved, flipping edges in place.
+		 * Returns false when the previous topology can't be repaired (a site folded over, the hull lost its convexity
+		 * or the flip budget ran out), in which case Process must be called again.
+		 * Only Sites are kept up to date; edges and hull are left empty.
+		 */
+		bool Repair(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionSettings& ProjectionSettings)
 		{
-			uint64 Edge;
+			if (!IsValid || Sites.IsEmpty()) { return false; }
+
+			PCGEX_DELETE(Triangulation)
+			DelaunayEdges.Empty();
+			DelaunayHull.Empty();
+
+			TArray<FVector2D> Positions2D;
+			ProjectionSettings.Project(Positions, Positions2D);
+
+			auto Orient = [&](const int32 A, const int32 B, const int32 C) { return Winding * FVector2D::CrossProduct(Positions2D[B] - Positions2D[A], Positions2D[C] - Positions2D[A]); };
+
+			const int32 NumSites = Sites.Num();
+			std::atomic<bool> bFolded{false};
+
+			PCGExMT::ParallelFor(
+				NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					const FDelaunaySite2& Site = Sites[i];
+					if (Orient(Site.Vtx[0], Site.Vtx[1], Site.Vtx[2]) <= 0) { bFolded = true; }
+				});
+
+			if (bFolded) { return false; }
+
+			// Flips never touch the hull, so it must still be convex
+			TMap<int32, int32> HullNext;
 			for (const FDelaunaySite2& Site : Sites)
 			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
+				if (!Site.bOnHull) { continue; }
+				for (int e = 0; e < 3; e++) { if (Site.Neighbors[e] == -1) { HullNext.Add(Site.Vtx[e], Site.Vtx[(e + 1) % 3]); } }
 			}
+
+			for (const TPair<int32, int32>& Hull : HullNext)
+			{
+				const int32* Next = HullNext.Find(Hull.Value);
+				if (!Next || Orient(Hull.Key, Hull.Value, *Next) < 0) { return false; }
+			}
+
+			// Lawson flips, seeded with every interior edge; stack entries are Site * 3 + Edge
+
+			TArray<int32> Stack;
+			Stack.Reserve(NumSites * 2);
+			for (int i = 0; i < NumSites; i++) { for (int e = 0; e < 3; e++) { if (Sites[i].Neighbors[e] > i) { Stack.Add(i * 3 + e); } } }
+
+			int32 Budget = NumSites * 4 + 1024;
+
+			while (!Stack.IsEmpty())
+			{
+				const int32 Key = Stack.Pop(false);
+				const int32 T = Key / 3;
+				const int32 E = Key % 3;
+
+				FDelaunaySite2& ST = Sites[T];
+				const int32 U = ST.Neighbors[E];
+				if (U == -1) { continue; }
+
+				const int32 A = ST.Vtx[E];
+				const int32 B = ST.Vtx[(E + 1) % 3];
+				const int32 C = ST.Vtx[(E + 2) % 3];
+
+				FDelaunaySite2& SU = Sites[U];
+				int32 F = -1;
+				for (int f = 0; f < 3; f++)
+				{
+					if (SU.Vtx[f] != B || SU.Vtx[(f + 1) % 3] != A) { continue; }
+					F = f;
+					break;
+				}
+
+				if (F == -1) { return false; }
+
+				const int32 D = SU.Vtx[(F + 2) % 3];
+				if (Winding * InCircle(Positions2D[A], Positions2D[B], Positions2D[C], Positions2D[D]) <= 0) { continue; }
+
+				if (--Budget < 0) { return false; }
+
+				// (A, B, C) + (B, A, D) -> (A, D, C) + (D, B, C)
+
+				const int32 NTB = ST.Neighbors[(E + 1) % 3];
+				const int32 NTC = ST.Neighbors[(E + 2) % 3];
+				const int32 NUA = SU.Neighbors[(F + 1) % 3];
+				const int32 NUD = SU.Neighbors[(F + 2) % 3];
+
+				ST = FDelaunaySite2(UE::Geometry::FIndex3i(A, D, C), UE::Geometry::FIndex3i(NUA, U, NTC), T);
+				SU = FDelaunaySite2(UE::Geometry::FIndex3i(D, B, C), UE::Geometry::FIndex3i(NUD, NTB, T), U);
+
+				if (NUA != -1) { for (int32& N : Sites[NUA].Neighbors) { if (N == U) { N = T; } } }
+				if (NTB != -1) { for (int32& N : Sites[NTB].Neighbors) { if (N == T) { N = U; } } }
+
+				Stack.Add(T * 3);
+				Stack.Add(T * 3 + 2);
+				Stack.Add(U * 3);
+				Stack.Add(U * 3 + 1);
+			}
+
+			PCGExMT::ParallelFor(
+				NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					FDelaunaySite2& Site = Sites[i];
+					Site.bOnHull = Site.Neighbors[0] == -1 || Site.Neighbors[1] == -1 || Site.Neighbors[2] == -1;
+				});
+
+			return true;
+		}
+
+		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
+		{
+			TArray<uint64> LongestEdges;
+			LongestEdges.SetNumUninitialized(Sites.Num());
+
+			PCGExMT::ParallelFor(
+				Sites.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					GetLongestEdge(Positions, Sites[i].Vtx, LongestEdges[i]);
+				});
+
+			RemoveSortedEdges(DelaunayEdges, LongestEdges);
+		}
+
+		/** Removes every edge of InEdgesToRemove from the sorted OutEdges. */
+		static void RemoveSortedEdges(TArray<uint64>& OutEdges, TArray<uint64>& InEdgesToRemove)
+		{
+			PCGEx::SortUnique(InEdgesToRemove);
+
+			int32 WriteIndex = 0;
+			int32 RemoveIndex = 0;
+			const int32 NumToRemove = InEdgesToRemove.Num();
+
+			for (int i = 0; i < OutEdges.Num(); i++)
+			{
+				const uint64 Edge = OutEdges[i];
+				while (RemoveIndex < NumToRemove && InEdgesToRemove[RemoveIndex] < Edge) { RemoveIndex++; }
+				if (RemoveIndex < NumToRemove && InEdgesToRemove[RemoveIndex] == Edge) { continue; }
+				OutEdges[WriteIndex++] = Edge;
+			}
+
+			OutEdges.SetNum(WriteIndex);
 		}
 	};
 
@@ -180,19 +483,40 @@ namespace PCGExGeo
 				}
 			}
 		}
+
+		/** Sorted vertex triple of face F, which lies opposite to Vtx[3 - F]. */
+		FIntVector GetFace(const int32 F) const { return FIntVector(Vtx[MTX[F][0]], Vtx[MTX[F][1]], Vtx[MTX[F][2]]); }
+
+		int32 FindFace(const FIntVector& Face) const
+		{
+			for (int i = 0; i < 4; i++) { if (GetFace(i) == Face) { return i; } }
+			return -1;
+		}
+
+		int32 FindFaceOpposite(const int32 Vertex) const
+		{
+			for (int i = 0; i < 4; i++) { if (Vtx[i] == Vertex) { return 3 - i; } }
+			return -1;
+		}
 	};
 
+	/**
+	 * Tetrahedralizes points in BRIO order, then extracts sites, edges and face adjacency in parallel.
+	 * DelaunayEdges is a sorted array of unique H64U edge hashes.
+	 * Once processed with faces, sites can be repaired in place with 2-3 and 3-2 flips after positions moved.
+	 */
 	class PCGEXTENDEDTOOLKIT_API TDelaunay3
 	{
 	public:
-		UE::Geometry::FDelaunay3* Tetrahedralization = nullptr;
+		UE::Geometry::FDelaunay3* Tetrahedralization = nullptr; // Vertex indices are in insertion order, not input order
 
 		TArray<FDelaunaySite3> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		TArray<uint64> DelaunayEdges;
 		TSet<int32> DelaunayHull;
 
 		bool IsValid = false;
+		bool bHasFaces = false;
 
 		TDelaunay3()
 		{
@@ -212,6 +536,7 @@ namespace PCGExGeo
 			DelaunayHull.Empty();
 
 			IsValid = false;
+			bHasFaces = false;
 		}
 
 		bool Process(const TArrayView<FVector>& Positions, const bool bComputeFaces = false)
@@ -219,88 +544,489 @@ namespace PCGExGeo
 			Clear();
 			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
 
+			TArray<int32> Order;
+			GetBRIOOrder(Positions, Order);
+
+			TArray<FVector> OrderedPositions;
+			OrderedPositions.SetNumUninitialized(Order.Num());
+			for (int i = 0; i < Order.Num(); i++) { OrderedPositions[i] = Positions[Order[i]]; }
+
 			Tetrahedralization = new UE::Geometry::FDelaunay3();
 
-			if (!Tetrahedralization->Triangulate(Positions))
+			if (!Tetrahedralization->Triangulate(OrderedPositions))
 			{
 				Clear();
 				return false;
 			}
 
+			OrderedPositions.Empty();
+
 			IsValid = true;
+			bHasFaces = bComputeFaces;
 
 			TArray<FIntVector4> Tetrahedra = Tetrahedralization->GetTetrahedra();
 
 			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
 
-			DelaunayEdges.Reserve(NumReserve);
+			Sites.SetNumUninitialized(NumSites);
+			DelaunayEdges.SetNumUninitialized(NumSites * 6);
 
-			TMap<uint64, int32> Faces;
-			if (bComputeFaces) { Faces.Reserve(NumSites); }
+			PCGExMT::ParallelFor(
+				NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					const FIntVector4& Tetra = Tetrahedra[i];
+					FDelaunaySite3& Site = Sites[i] = FDelaunaySite3(FIntVector4(Order[Tetra.X], Order[Tetra.Y], Order[Tetra.Z], Order[Tetra.W]), i);
 
-			Sites.SetNumUninitialized(NumSites);
+					int32 EdgeIndex = i * 6;
+					for (int a = 0; a < 4; a++)
+					{
+						for (int b = a + 1; b < 4; b++) { DelaunayEdges[EdgeIndex++] = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]); }
+					}
+
+					if (bComputeFaces) { Site.ComputeFaces(); }
+				});
 
-			for (int i = 0; i < NumSites; i++)
+			PCGEx::SortUnique(DelaunayEdges);
+
+			if (bComputeFaces)
 			{
-				FDelaunaySite3& Site = Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
+				// Shared faces end up next to each other once sorted; payload is Site * 4 + Face
 
-				for (int a = 0; a < 4; a++)
-				{
-					for (int b = a + 1; b < 4; b++)
+				TArray<uint64> FaceKeys;
+				TArray<int32> FaceOwners;
+				FaceKeys.SetNumUninitialized(NumSites * 4);
+				FaceOwners.SetNumUninitialized(NumSites * 4);
+
+				PCGExMT::ParallelFor(
+					NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
 					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
-					}
+						for (int f = 0; f < 4; f++)
+						{
+							FaceKeys[i * 4 + f] = Sites[i].Faces[f];
+							FaceOwners[i * 4 + f] = i * 4 + f;
+						}
+					});
+
+				PCGEx::RadixSort(FaceKeys, FaceOwners);
+
+				PCGExMT::ParallelFor(
+					FaceKeys.Num() - 1, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+					{
+						if (FaceKeys[i] != FaceKeys[i + 1] || (i > 0 && FaceKeys[i - 1] == FaceKeys[i])) { return; }
+
+						const int32 A = FaceOwners[i];
+						const int32 B = FaceOwners[i + 1];
+						Sites[A / 4].Neighbors[A % 4] = B / 4;
+						Sites[B / 4].Neighbors[B % 4] = A / 4;
+					});
+			}
+
+			PCGExMT::ParallelFor(
+				NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					FDelaunaySite3& Site = Sites[i];
+					for (int f = 0; f < 4; f++) { if (Site.Neighbors[f] == -1) { Site.bOnHull = true; } }
+				});
+
+			for (const FDelaunaySite3& Site : Sites)
+			{
+				if (!Site.bOnHull) { continue; }
+				for (int f = 0; f < 4; f++)
+				{
+					if (Site.Neighbors[f] != -1) { continue; }
+					for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
 				}
+			}
 
-				if (bComputeFaces)
+			Tetrahedra.Empty();
+
+			return IsValid;
+		}
+
+		/**
+		 * Restores the Delaunay property of Sites after Positions moved, flipping faces and edges in place.
+		 * Requires sites processed with faces. Returns false when the previous topology can't be repaired (a site folded
+		 * over, the hull lost its convexity, a violation is stuck in an unflippable configuration or the flip budget
+		 * ran out), in which case Process must be called again.
+		 * Only Sites are kept up to date; edges and hull are left empty.
+		 */
+		bool Repair(const TArrayView<FVector>& Positions)
+		{
+			if (!IsValid || !bHasFaces || Sites.IsEmpty()) { return false; }
+
+			PCGEX_DELETE(Tetrahedralization)
+			DelaunayEdges.Empty();
+			DelaunayHull.Empty();
+
+			const int32 NumSites = Sites.Num();
+
+			auto GetApex = [&](const int32 Site, const int32 F) { return Sites[Site].Vtx[3 - F]; };
+			auto GetOppositeApex = [&](const int32 Site, const int32 F)
+			{
+				const FDelaunaySite3& Other = Sites[Sites[Site].Neighbors[F]];
+				const int32 OtherFace = Other.FindFace(Sites[Site].GetFace(F));
+				return OtherFace == -1 ? -1 : Other.Vtx[3 - OtherFace];
+			};
+
+			auto IsLocallyDelaunay = [&](const int32 Site, const int32 OppositeApex)
+			{
+				const FDelaunaySite3& S = Sites[Site];
+				const FVector& A = Positions[S.Vtx[0]];
+				const FVector& B = Positions[S.Vtx[1]];
+				const FVector& C = Positions[S.Vtx[2]];
+				const FVector& D = Positions[S.Vtx[3]];
+				return InSphere(A, B, C, D, Positions[OppositeApex]) * Orient3(A, B, C, D) <= 0;
+			};
+
+			// Every interior face must still separate its two apexes
+
+			std::atomic<bool> bFolded{false};
+			PCGExMT::ParallelFor(
+				NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
 				{
-					Site.ComputeFaces();
+					const FDelaunaySite3& Site = Sites[i];
+					if (Orient3(Positions[Site.Vtx[0]], Positions[Site.Vtx[1]], Positions[Site.Vtx[2]], Positions[Site.Vtx[3]]) == 0)
+					{
+						bFolded = true;
+						return;
+					}
 
 					for (int f = 0; f < 4; f++)
 					{
-						const uint64 FH = Site.Faces[f];
-						if (const int32* NeighborId = Faces.Find(FH))
-						{
-							Faces.Remove(FH);
-							Site.SetAdjacency(FH, *NeighborId);
-							Sites[*NeighborId].SetAdjacency(FH, i);
-						}
-						else
+						if (Site.Neighbors[f] < i) { continue; }
+
+						const int32 OppositeApex = GetOppositeApex(i, f);
+						const FIntVector Face = Site.GetFace(f);
+						const FVector& A = Positions[Face.X];
+						const FVector& B = Positions[Face.Y];
+						const FVector& C = Positions[Face.Z];
+
+						if (OppositeApex == -1 || Orient3(A, B, C, Positions[GetApex(i, f)]) * Orient3(A, B, C, Positions[OppositeApex]) >= 0)
 						{
-							Faces.Add(FH, Site.Id);
+							bFolded = true;
+							return;
 						}
 					}
+				});
+
+			if (bFolded) { return false; }
+
+			// Flips never touch the hull, so it must still be convex : hull faces sharing an edge can't bend outward
+
+			TArray<int32> HullFaces;
+			for (int i = 0; i < NumSites; i++) { for (int f = 0; f < 4; f++) { if (Sites[i].Neighbors[f] == -1) { HullFaces.Add(i * 4 + f); } } }
+
+			TArray<uint64> HullEdges;
+			TArray<int32> HullEdgeOwners;
+			HullEdges.SetNumUninitialized(HullFaces.Num() * 3);
+			HullEdgeOwners.SetNumUninitialized(HullFaces.Num() * 3);
+
+			for (int i = 0; i < HullFaces.Num(); i++)
+			{
+				const FIntVector Face = Sites[HullFaces[i] / 4].GetFace(HullFaces[i] % 4);
+				HullEdges[i * 3] = PCGEx::H64U(Face.X, Face.Y);
+				HullEdges[i * 3 + 1] = PCGEx::H64U(Face.Y, Face.Z);
+				HullEdges[i * 3 + 2] = PCGEx::H64U(Face.X, Face.Z);
+				for (int e = 0; e < 3; e++) { HullEdgeOwners[i * 3 + e] = HullFaces[i]; }
+			}
+
+			PCGEx::RadixSort(HullEdges, HullEdgeOwners);
+
+			for (int i = 0; i < HullEdges.Num(); i += 2)
+			{
+				if (i + 1 >= HullEdges.Num() || HullEdges[i] != HullEdges[i + 1]) { return false; }
+
+				for (int j = 0; j < 2; j++)
+				{
+					const int32 Owner = HullEdgeOwners[i + j];
+					const int32 Other = HullEdgeOwners[i + 1 - j];
+					const FIntVector Face = Sites[Owner / 4].GetFace(Owner % 4);
+					const FIntVector OtherFace = Sites[Other / 4].GetFace(Other % 4);
+
+					int32 OtherVertex = OtherFace.X;
+					if (OtherVertex == Face.X || OtherVertex == Face.Y || OtherVertex == Face.Z) { OtherVertex = OtherFace.Y; }
+					if (OtherVertex == Face.X || OtherVertex == Face.Y || OtherVertex == Face.Z) { OtherVertex = OtherFace.Z; }
+
+					const FVector& A = Positions[Face.X];
+					const FVector& B = Positions[Face.Y];
+					const FVector& C = Positions[Face.Z];
+					if (Orient3(A, B, C, Positions[GetApex(Owner / 4, Owner % 4)]) * Orient3(A, B, C, Positions[OtherVertex]) < 0) { return false; }
 				}
 			}
 
-			for (FDelaunaySite3& Site : Sites)
+			// Flips, seeded with every interior face; stack entries are Site * 4 + Face
+
+			TArray<int32> Stack;
+			Stack.Reserve(NumSites * 2);
+			for (int i = 0; i < NumSites; i++) { for (int f = 0; f < 4; f++) { if (Sites[i].Neighbors[f] > i) { Stack.Add(i * 4 + f); } } }
+
+			TArray<int32> FreeSites;
+			int32 Budget = NumSites * 4 + 1024;
+
+			while (!Stack.IsEmpty())
 			{
-				for (int f = 0; f < 4; f++)
+				const int32 Key = Stack.Pop(false);
+				const int32 T = Key / 4;
+				const int32 F = Key % 4;
+
+				if (Sites[T].Id == -1) { continue; }
+
+				const int32 U = Sites[T].Neighbors[F];
+				if (U == -1) { continue; }
+
+				const int32 E = GetOppositeApex(T, F);
+				if (E == -1) { return false; }
+
+				if (IsLocallyDelaunay(T, E)) { continue; }
+
+				const FIntVector Face = Sites[T].GetFace(F);
+				const int32 D = GetApex(T, F);
+				const int32 FaceVtx[3] = {Face.X, Face.Y, Face.Z};
+
+				// Where does segment D-E cross the plane of the shared face, relative to each of its edges
+				double Sides[3];
+				for (int e = 0; e < 3; e++) { Sides[e] = Orient3(Positions[FaceVtx[e]], Positions[FaceVtx[(e + 1) % 3]], Positions[D], Positions[E]); }
+
+				if (Sides[0] == 0 || Sides[1] == 0 || Sides[2] == 0) { continue; }
+
+				const bool S0 = Sides[0] > 0;
+				const bool S1 = Sides[1] > 0;
+				const bool S2 = Sides[2] > 0;
+
+				if (S0 == S1 && S1 == S2)
 				{
-					if (Site.Neighbors[f] == -1)
+					// Crossing inside the face : 2-3 flip
+					if (--Budget < 0) { return false; }
+
+					const int32 Old[2] = {T, U};
+					const FIntVector4 New[3] = {
+						FIntVector4(Face.X, Face.Y, D, E),
+						FIntVector4(Face.Y, Face.Z, D, E),
+						FIntVector4(Face.Z, Face.X, D, E)
+					};
+
+					if (!Flip(MakeArrayView(Old, 2), MakeArrayView(New, 3), FreeSites, Stack)) { return false; }
+					continue;
+				}
+
+				// Crossing outside a single edge : 3-2 flip if that edge is shared by exactly three sites
+				const int32 Reflex = S0 != S1 && S0 != S2 ? 0 : S1 != S0 && S1 != S2 ? 1 : 2;
+				const int32 X = FaceVtx[Reflex];
+				const int32 Y = FaceVtx[(Reflex + 1) % 3];
+				const int32 Z = FaceVtx[(Reflex + 2) % 3];
+
+				const int32 V = Sites[T].Neighbors[Sites[T].FindFaceOpposite(Z)];
+				if (V == -1 || V != Sites[U].Neighbors[Sites[U].FindFaceOpposite(Z)]) { continue; }
+
+				if (--Budget < 0) { return false; }
+
+				const int32 Old[3] = {T, U, V};
+				const FIntVector4 New[2] = {
+					FIntVector4(Z, D, E, X),
+					FIntVector4(Z, D, E, Y)
+				};
+
+				if (!Flip(MakeArrayView(Old, 3), MakeArrayView(New, 2), FreeSites, Stack)) { return false; }
+			}
+
+			if (!FreeSites.IsEmpty())
+			{
+				TArray<int32> Remap;
+				Remap.SetNumUninitialized(Sites.Num());
+
+				int32 NumAlive = 0;
+				for (int i = 0; i < Sites.Num(); i++)
+				{
+					if (Sites[i].Id == -1)
 					{
-						for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
-						Site.bOnHull = true;
-						break;
+						Remap[i] = -1;
+						continue;
 					}
+
+					Remap[i] = NumAlive;
+					if (NumAlive != i) { Sites[NumAlive] = Sites[i]; }
+					NumAlive++;
 				}
+
+				Sites.SetNum(NumAlive);
+
+				PCGExMT::ParallelFor(
+					NumAlive, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+					{
+						FDelaunaySite3& Site = Sites[i];
+						Site.Id = i;
+						for (int32& N : Site.Neighbors) { if (N != -1) { N = Remap[N]; } }
+					});
 			}
 
-			Faces.Empty();
-			Tetrahedra.Empty();
+			// Violations left in unflippable configurations can only be resolved by a full rebuild
 
-			return IsValid;
+			std::atomic<bool> bStuck{false};
+			PCGExMT::ParallelFor(
+				Sites.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					FDelaunaySite3& Site = Sites[i];
+					Site.bOnHull = false;
+
+					for (int f = 0; f < 4; f++)
+					{
+						if (Site.Neighbors[f] == -1)
+						{
+							Site.bOnHull = true;
+							continue;
+						}
+
+						if (Site.Neighbors[f] < i) { continue; }
+
+						const int32 OppositeApex = GetOppositeApex(i, f);
+						if (OppositeApex == -1 || !IsLocallyDelaunay(i, OppositeApex)) { bStuck = true; }
+					}
+				});
+
+			return !bStuck;
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite3& Site : Sites)
+			TArray<uint64> LongestEdges;
+			LongestEdges.SetNumUninitialized(Sites.Num());
+
+			PCGExMT::ParallelFor(
+				Sites.Num(), PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					GetLongestEdge(Positions, Sites[i].Vtx, LongestEdges[i]);
+				});
+
+			TDelaunay2::RemoveSortedEdges(DelaunayEdges, LongestEdges);
+		}
+
+	protected:
+		/**
+		 * Replaces the Old sites with New ones filling the same volume, reusing their slots (then free ones),
+		 * and stitches adjacency to the surrounding sites. Unused old slots are freed.
+		 */
+		bool Flip(const TArrayView<const int32>& Old, const TArrayView<const FIntVector4>& New, TArray<int32>& FreeSites, TArray<int32>& Stack)
+		{
+			FIntVector OuterFaces[6];
+			int32 OuterNeighbors[6];
+			int32 NumOuter = 0;
+
+			for (const int32 S : Old)
 			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
+				for (int f = 0; f < 4; f++)
+				{
+					const int32 N = Sites[S].Neighbors[f];
+					if (N != -1 && Old.Contains(N)) { continue; }
+					if (NumOuter == 6) { return false; }
+					OuterFaces[NumOuter] = Sites[S].GetFace(f);
+					OuterNeighbors[NumOuter++] = N;
+				}
+			}
+
+			int32 Slots[3];
+			for (int i = 0; i < New.Num(); i++)
+			{
+				if (i < Old.Num()) { Slots[i] = Old[i]; }
+				else if (!FreeSites.IsEmpty()) { Slots[i] = FreeSites.Pop(false); }
+				else { Slots[i] = Sites.Emplace(FIntVector4(-1)); }
+
+				Sites[Slots[i]] = FDelaunaySite3(New[i], Slots[i]);
+				Sites[Slots[i]].ComputeFaces();
 			}
+
+			for (int i = New.Num(); i < Old.Num(); i++)
+			{
+				Sites[Old[i]].Id = -1;
+				FreeSites.Add(Old[i]);
+			}
+
+			for (int i = 0; i < New.Num(); i++)
+			{
+				FDelaunaySite3& Site = Sites[Slots[i]];
+
+				for (int f = 0; f < 4; f++)
+				{
+					const FIntVector Face = Site.GetFace(f);
+					bool bFound = false;
+
+					for (int j = 0; j < New.Num() && !bFound; j++)
+					{
+						if (j == i || Sites[Slots[j]].FindFace(Face) == -1) { continue; }
+						Site.Neighbors[f] = Slots[j];
+						bFound = true;
+					}
+
+					for (int o = 0; o < NumOuter && !bFound; o++)
+					{
+						if (OuterFaces[o] != Face) { continue; }
+
+						const int32 N = OuterNeighbors[o];
+						Site.Neighbors[f] = N;
+						if (N != -1) { Sites[N].Neighbors[Sites[N].FindFace(Face)] = Slots[i]; }
+
+						Stack.Add(Slots[i] * 4 + f);
+						bFound = true;
+					}
+
+					if (!bFound) { return false; }
+				}
+			}
+
+			return true;
 		}
 	};
+
+	/**
+	 * Averages each position with the centroids of the sites it belongs to.
+	 * Sites are gathered per vertex through a counting pass, so every step runs in parallel; each vertex sums its
+	 * sites in index order to keep results deterministic.
+	 */
+	template <typename SiteType>
+	static void GetCentroidAverages(const TArrayView<FVector>& Positions, const TArray<SiteType>& Sites, TArray<FVector>& OutAverages)
+	{
+		constexpr int32 NumVtx = sizeof(SiteType::Vtx) / sizeof(int32);
+
+		const int32 NumPoints = Positions.Num();
+		const int32 NumSites = Sites.Num();
+
+		TArray<FVector> Centroids;
+		Centroids.SetNumUninitialized(NumSites);
+
+		const TUniquePtr<std::atomic<int32>[]> Counts = MakeUnique<std::atomic<int32>[]>(NumPoints);
+		PCGExMT::ParallelFor(NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i) { Counts[i].store(0, std::memory_order_relaxed); });
+
+		PCGExMT::ParallelFor(
+			NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				GetCentroid(Positions, Sites[i].Vtx, Centroids[i]);
+				for (const int32 Vtx : Sites[i].Vtx) { Counts[Vtx].fetch_add(1, std::memory_order_relaxed); }
+			});
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumPoints + 1);
+		Offsets[0] = 0;
+		for (int i = 0; i < NumPoints; i++) { Offsets[i + 1] = Offsets[i] + Counts[i].load(std::memory_order_relaxed); }
+
+		TArray<int32> VtxSites;
+		VtxSites.SetNumUninitialized(NumSites * NumVtx);
+
+		PCGExMT::ParallelFor(
+			NumSites, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				for (const int32 Vtx : Sites[i].Vtx) { VtxSites[Offsets[Vtx] + Counts[Vtx].fetch_sub(1, std::memory_order_relaxed) - 1] = i; }
+			});
+
+		OutAverages.SetNumUninitialized(NumPoints);
+
+		PCGExMT::ParallelFor(
+			NumPoints, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+			{
+				TArrayView<int32> Incident = MakeArrayView(VtxSites.GetData() + Offsets[i], Offsets[i + 1] - Offsets[i]);
+				Incident.Sort();
+
+				FVector Sum = Positions[i];
+				for (const int32 Site : Incident) { Sum += Centroids[Site]; }
+				OutAverages[i] = Sum / (Incident.Num() + 1);
+			});
+	}
 }
@@ -0,0 +1,530 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExGeo.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * 2D convex hull, Andrew's monotone chain.
+	 * Points strictly inside the quadrilateral spanned by the X/Y extremes are discarded first (Akl-Toussaint),
+	 * in parallel, so only a thin band of candidates is sorted. Collinear points along the hull are dropped.
+	 */
+	class PCGEXTENDEDTOOLKIT_API TConvexHull2
+	{
+	public:
+		TArray<int32> Polygon; // Hull vertices, counter-clockwise in projected space
+		TSet<uint64> HullEdges;
+		TSet<int32> Hull;
+		bool IsValid = false;
+
+		TConvexHull2()
+		{
+		}
+
+		~TConvexHull2()
+		{
+			Clear();
+		}
+
+		void Clear()
+		{
+			Polygon.Empty();
+			HullEdges.Empty();
+			Hull.Empty();
+			IsValid = false;
+		}
+
+		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionSettings& ProjectionSettings)
+		{
+			Clear();
+
+			const int32 NumPositions = Positions.Num();
+			if (NumPositions <= 2) { return false; }
+
+			TArray<FVector2D> Positions2D;
+			ProjectionSettings.Project(Positions, Positions2D);
+
+			auto Less = [&](const int32 A, const int32 B)
+			{
+				const FVector2D& PA = Positions2D[A];
+				const FVector2D& PB = Positions2D[B];
+				if (PA.X != PB.X) { return PA.X < PB.X; }
+				if (PA.Y != PB.Y) { return PA.Y < PB.Y; }
+				return A < B;
+			};
+
+			auto Cross = [&](const int32 O, const int32 A, const int32 B)
+			{
+				return FVector2D::CrossProduct(Positions2D[A] - Positions2D[O], Positions2D[B] - Positions2D[O]);
+			};
+
+			// Extremes, in counter-clockwise order : min X, min Y, max X, max Y
+
+			int32 Extremes[4] = {0, 0, 0, 0};
+			for (int i = 1; i < NumPositions; i++)
+			{
+				const FVector2D& P = Positions2D[i];
+				if (Less(i, Extremes[0])) { Extremes[0] = i; }
+				if (P.Y < Positions2D[Extremes[1]].Y) { Extremes[1] = i; }
+				if (Less(Extremes[2], i)) { Extremes[2] = i; }
+				if (P.Y > Positions2D[Extremes[3]].Y) { Extremes[3] = i; }
+			}
+
+			TArray<bool> Keep;
+			Keep.SetNumUninitialized(NumPositions);
+
+			PCGExMT::ParallelFor(
+				NumPositions, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					bool bInside = true;
+					for (int e = 0; e < 4 && bInside; e++)
+					{
+						const int32 A = Extremes[e];
+						const int32 B = Extremes[(e + 1) % 4];
+						if (A == B) { continue; }
+						bInside = Cross(A, B, i) > 0;
+					}
+					Keep[i] = !bInside;
+				});
+
+			TArray<int32> Candidates;
+			Candidates.Reserve(NumPositions);
+			for (int i = 0; i < NumPositions; i++) { if (Keep[i]) { Candidates.Add(i); } }
+			Keep.Empty();
+
+			Candidates.Sort(Less);
+
+			const int32 NumCandidates = Candidates.Num();
+			TArray<int32> Chain;
+			Chain.SetNumUninitialized(NumCandidates * 2);
+			int32 K = 0;
+
+			for (int i = 0; i < NumCandidates; i++)
+			{
+				while (K >= 2 && Cross(Chain[K - 2], Chain[K - 1], Candidates[i]) <= 0) { K--; }
+				Chain[K++] = Candidates[i];
+			}
+
+			for (int i = NumCandidates - 2, LowerSize = K + 1; i >= 0; i--)
+			{
+				while (K >= LowerSize && Cross(Chain[K - 2], Chain[K - 1], Candidates[i]) <= 0) { K--; }
+				Chain[K++] = Candidates[i];
+			}
+
+			// Last point is the first one
+			Chain.SetNum(FMath::Max(0, K - 1));
+
+			if (Chain.Num() < 3) { return false; }
+
+			Polygon = MoveTemp(Chain);
+			Hull.Append(Polygon);
+			HullEdges.Reserve(Polygon.Num());
+			for (int i = 0; i < Polygon.Num(); i++) { HullEdges.Add(PCGEx::H64U(Polygon[i], Polygon[(i + 1) % Polygon.Num()])); }
+
+			IsValid = true;
+			return IsValid;
+		}
+	};
+
+	/**
+	 * 3D convex hull, Quickhull.
+	 * Points are assigned to the faces of an initial tetrahedron in parallel, which drops every point inside it;
+	 * faces are then expanded toward their furthest outside point until no outside point remains.
+	 * Hull faces are triangles, wound counter-clockwise seen from outside.
+	 */
+	class PCGEXTENDEDTOOLKIT_API TConvexHull3
+	{
+	public:
+		struct FFace
+		{
+			int32 Vtx[3];
+			int32 Adjacency[3]; // Face across edge Vtx[i] -> Vtx[(i+1)%3]
+			FVector Normal = FVector::ZeroVector;
+			double Offset = 0;
+			TArray<int32> Outside;
+			int32 Furthest = -1;
+			double FurthestDistance = 0;
+			int32 VisitTag = -1;
+			bool bValid = true;
+
+			double Distance(const FVector& P) const { return FVector::DotProduct(Normal, P) - Offset; }
+		};
+
+		TArray<FFace> Faces;
+		TSet<uint64> HullEdges;
+		TSet<int32> Hull;
+		bool IsValid = false;
+
+		TConvexHull3()
+		{
+		}
+
+		~TConvexHull3()
+		{
+			Clear();
+		}
+
+		void Clear()
+		{
+			Faces.Empty();
+			HullEdges.Empty();
+			Hull.Empty();
+			IsValid = false;
+		}
+
+		bool Process(const TArrayView<FVector>& Positions)
+		{
+			Clear();
+
+			const int32 NumPositions = Positions.Num();
+			if (NumPositions <= 3) { return false; }
+
+			double MaxAbs = 0;
+			for (const FVector& P : Positions) { MaxAbs = FMath::Max(MaxAbs, P.GetAbsMax()); }
+			const double Tolerance = 9 * DBL_EPSILON * MaxAbs; // Upper bound of 3 * eps * (|x| + |y| + |z|)
+
+			int32 Simplex[4];
+			if (!FindInitialSimplex(Positions, Tolerance, Simplex)) { return false; }
+
+			const FVector Centroid = (Positions[Simplex[0]] + Positions[Simplex[1]] + Positions[Simplex[2]] + Positions[Simplex[3]]) * 0.25;
+
+			// Initial tetrahedron, faces oriented away from its centroid
+
+			const int32 Tetra[4][3] = {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};
+			for (int f = 0; f < 4; f++)
+			{
+				int32 A = Simplex[Tetra[f][0]];
+				int32 B = Simplex[Tetra[f][1]];
+				const int32 C = Simplex[Tetra[f][2]];
+				const FVector N = FVector::CrossProduct(Positions[B] - Positions[A], Positions[C] - Positions[A]);
+				if (FVector::DotProduct(N, Positions[A] - Centroid) < 0) { Swap(A, B); }
+				AddFace(Positions, A, B, C);
+			}
+
+			LinkAdjacency(0, 4);
+
+			// Assign every point to the first face it lies above, in parallel
+
+			TArray<int32> Assignment;
+			Assignment.SetNumUninitialized(NumPositions);
+
+			PCGExMT::ParallelFor(
+				NumPositions, PCGExMT::GetNumPoolWorkers(), [&](const int32 i)
+				{
+					Assignment[i] = -1;
+					for (int f = 0; f < 4; f++)
+					{
+						if (Faces[f].Distance(Positions[i]) > Tolerance)
+						{
+							Assignment[i] = f;
+							break;
+						}
+					}
+				});
+
+			for (int i = 0; i < 4; i++) { Assignment[Simplex[i]] = -1; }
+			for (int i = 0; i < NumPositions; i++) { if (Assignment[i] != -1) { AddOutside(Positions, Assignment[i], i); } }
+			Assignment.Empty();
+
+			// Expand
+
+			TArray<int32> Pending = {0, 1, 2, 3};
+			TArray<int32> Visible;
+			TArray<int32> Stack;
+			TArray<TPair<int32, int32>> Horizon; // Visible face, edge index
+			TArray<int32> Orphans;
+			TMap<int32, int32> NewFaceByStart;
+			TMap<int32, int32> HorizonNext;
+
+			int32 Tag = 0;
+
+			while (!Pending.IsEmpty())
+			{
+				const int32 SeedIndex = Pending.Pop(false);
+				if (!Faces[SeedIndex].bValid || Faces[SeedIndex].Outside.IsEmpty()) { continue; }
+
+				const int32 Eye = Faces[SeedIndex].Furthest;
+				const FVector& EyePosition = Positions[Eye];
+
+				// Gather visible faces and the horizon around them
+
+				Tag++;
+				Visible.Reset();
+				Horizon.Reset();
+				Stack.Reset();
+
+				Stack.Add(SeedIndex);
+				Faces[SeedIndex].VisitTag = Tag;
+
+				while (!Stack.IsEmpty())
+				{
+					const int32 FaceIndex = Stack.Pop(false);
+					Visible.Add(FaceIndex);
+
+					for (int e = 0; e < 3; e++)
+					{
+						const int32 Neighbor = Faces[FaceIndex].Adjacency[e];
+						FFace& NeighborFace = Faces[Neighbor];
+
+						if (NeighborFace.VisitTag == Tag) { continue; }
+						if (NeighborFace.Distance(EyePosition) > Tolerance)
+						{
+							NeighborFace.VisitTag = Tag;
+							Stack.Add(Neighbor);
+						}
+						else
+						{
+							Horizon.Emplace(FaceIndex, e);
+						}
+					}
+				}
+
+				// The horizon must be a single simple loop; a pinched one (shared vertex, or a visible
+				// region wrapping around a hidden face within tolerance) can't be coned. Skip the eye instead.
+
+				if (!IsSimpleHorizon(Horizon, HorizonNext))
+				{
+					DropOutside(Positions, SeedIndex, Eye);
+					if (!Faces[SeedIndex].Outside.IsEmpty()) { Pending.Add(SeedIndex); }
+					continue;
+				}
+
+				// Cone the horizon to the eye
+
+				Orphans.Reset();
+				for (const int32 FaceIndex : Visible)
+				{
+					FFace& Face = Faces[FaceIndex];
+					Face.bValid = false;
+					for (const int32 Outside : Face.Outside) { if (Outside != Eye) { Orphans.Add(Outside); } }
+					Face.Outside.Empty();
+				}
+
+				const int32 FirstNewFace = Faces.Num();
+				NewFaceByStart.Reset();
+
+				for (const TPair<int32, int32>& Edge : Horizon)
+				{
+					const FFace& Face = Faces[Edge.Key];
+					const int32 A = Face.Vtx[Edge.Value];
+					const int32 B = Face.Vtx[(Edge.Value + 1) % 3];
+					const int32 Outer = Face.Adjacency[Edge.Value];
+
+					const int32 NewFaceIndex = AddFace(Positions, A, B, Eye);
+					Faces[NewFaceIndex].Adjacency[0] = Outer;
+					NewFaceByStart.Add(A, NewFaceIndex);
+
+					FFace& OuterFace = Faces[Outer];
+					for (int e = 0; e < 3; e++)
+					{
+						if (OuterFace.Vtx[e] == B && OuterFace.Vtx[(e + 1) % 3] == A)
+						{
+							OuterFace.Adjacency[e] = NewFaceIndex;
+							break;
+						}
+					}
+				}
+
+				for (int f = FirstNewFace; f < Faces.Num(); f++)
+				{
+					const int32 Next = NewFaceByStart.FindChecked(Faces[f].Vtx[1]);
+					Faces[f].Adjacency[1] = Next;
+					Faces[Next].Adjacency[2] = f;
+				}
+
+				// Reassign orphans to new faces
+
+				for (const int32 Orphan : Orphans)
+				{
+					for (int f = FirstNewFace; f < Faces.Num(); f++)
+					{
+						if (Faces[f].Distance(Positions[Orphan]) > Tolerance)
+						{
+							AddOutside(Positions, f, Orphan);
+							break;
+						}
+					}
+				}
+
+				for (int f = FirstNewFace; f < Faces.Num(); f++) { if (!Faces[f].Outside.IsEmpty()) { Pending.Add(f); } }
+			}
+
+			for (const FFace& Face : Faces)
+			{
+				if (!Face.bValid) { continue; }
+				for (int i = 0; i < 3; i++)
+				{
+					Hull.Add(Face.Vtx[i]);
+					HullEdges.Add(PCGEx::H64U(Face.Vtx[i], Face.Vtx[(i + 1) % 3]));
+				}
+			}
+
+			IsValid = true;
+			return IsValid;
+		}
+
+	protected:
+		int32 AddFace(const TArrayView<FVector>& Positions, const int32 A, const int32 B, const int32 C)
+		{
+			FFace& Face = Faces.Emplace_GetRef();
+			Face.Vtx[0] = A;
+			Face.Vtx[1] = B;
+			Face.Vtx[2] = C;
+			Face.Adjacency[0] = Face.Adjacency[1] = Face.Adjacency[2] = -1;
+			Face.Normal = FVector::CrossProduct(Positions[B] - Positions[A], Positions[C] - Positions[A]).GetSafeNormal();
+			Face.Offset = FVector::DotProduct(Face.Normal, Positions[A]);
+			return Faces.Num() - 1;
+		}
+
+		void AddOutside(const TArrayView<FVector>& Positions, const int32 FaceIndex, const int32 PointIndex)
+		{
+			FFace& Face = Faces[FaceIndex];
+			const double Dist = Face.Distance(Positions[PointIndex]);
+			if (Face.Furthest == -1 || Dist > Face.FurthestDistance)
+			{
+				Face.Furthest = PointIndex;
+				Face.FurthestDistance = Dist;
+			}
+			Face.Outside.Add(PointIndex);
+		}
+
+		/** Removes a point from a face's outside set, and refreshes its furthest point. */
+		void DropOutside(const TArrayView<FVector>& Positions, const int32 FaceIndex, const int32 PointIndex)
+		{
+			FFace& Face = Faces[FaceIndex];
+			Face.Outside.RemoveSingleSwap(PointIndex, false);
+			Face.Furthest = -1;
+			Face.FurthestDistance = 0;
+			for (const int32 Outside : Face.Outside)
+			{
+				const double Dist = Face.Distance(Positions[Outside]);
+				if (Face.Furthest == -1 || Dist > Face.FurthestDistance)
+				{
+					Face.Furthest = Outside;
+					Face.FurthestDistance = Dist;
+				}
+			}
+		}
+
+		/** Whether horizon edges chain into exactly one loop, each vertex starting a single edge. */
+		bool IsSimpleHorizon(const TArray<TPair<int32, int32>>& Horizon, TMap<int32, int32>& Next) const
+		{
+			if (Horizon.Num() < 3) { return false; }
+
+			Next.Reset();
+			for (const TPair<int32, int32>& Edge : Horizon)
+			{
+				const FFace& Face = Faces[Edge.Key];
+				const int32 A = Face.Vtx[Edge.Value];
+				if (Next.Contains(A)) { return false; }
+				Next.Add(A, Face.Vtx[(Edge.Value + 1) % 3]);
+			}
+
+			const int32 First = Faces[Horizon[0].Key].Vtx[Horizon[0].Value];
+			int32 Current = First;
+			for (int i = 0; i < Horizon.Num(); i++)
+			{
+				const int32* NextVtx = Next.Find(Current);
+				if (!NextVtx) { return false; }
+				Current = *NextVtx;
+				if (Current == First) { return i == Horizon.Num() - 1; }
+			}
+
+			return false;
+		}
+
+		/** Links faces in [First, Last) through their shared edges. */
+		void LinkAdjacency(const int32 First, const int32 Last)
+		{
+			for (int f = First; f < Last; f++)
+			{
+				for (int e = 0; e < 3; e++)
+				{
+					const int32 A = Faces[f].Vtx[e];
+					const int32 B = Faces[f].Vtx[(e + 1) % 3];
+					for (int o = First; o < Last && Faces[f].Adjacency[e] == -1; o++)
+					{
+						if (o == f) { continue; }
+						for (int oe = 0; oe < 3; oe++)
+						{
+							if (Faces[o].Vtx[oe] == B && Faces[o].Vtx[(oe + 1) % 3] == A)
+							{
+								Faces[f].Adjacency[e] = o;
+								break;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		static bool FindInitialSimplex(const TArrayView<FVector>& Positions, const double Tolerance, int32 (&OutSimplex)[4])
+		{
+			const int32 NumPositions = Positions.Num();
+
+			int32 Extremes[6] = {0, 0, 0, 0, 0, 0};
+			for (int i = 1; i < NumPositions; i++)
+			{
+				const FVector& P = Positions[i];
+				for (int Axis = 0; Axis < 3; Axis++)
+				{
+					if (P[Axis] < Positions[Extremes[Axis * 2]][Axis]) { Extremes[Axis * 2] = i; }
+					if (P[Axis] > Positions[Extremes[Axis * 2 + 1]][Axis]) { Extremes[Axis * 2 + 1] = i; }
+				}
+			}
+
+			// Most distant pair of extremes
+
+			double BestDist = -1;
+			for (int i = 0; i < 6; i++)
+			{
+				for (int j = i + 1; j < 6; j++)
+				{
+					const double Dist = FVector::DistSquared(Positions[Extremes[i]], Positions[Extremes[j]]);
+					if (Dist <= BestDist) { continue; }
+					BestDist = Dist;
+					OutSimplex[0] = Extremes[i];
+					OutSimplex[1] = Extremes[j];
+				}
+			}
+
+			if (BestDist <= Tolerance * Tolerance) { return false; }
+
+			// Furthest point from that line
+
+			const FVector& A = Positions[OutSimplex[0]];
+			const FVector AB = (Positions[OutSimplex[1]] - A).GetSafeNormal();
+
+			BestDist = -1;
+			for (int i = 0; i < NumPositions; i++)
+			{
+				const FVector AP = Positions[i] - A;
+				const double Dist = (AP - AB * FVector::DotProduct(AP, AB)).SizeSquared();
+				if (Dist <= BestDist) { continue; }
+				BestDist = Dist;
+				OutSimplex[2] = i;
+			}
+
+			if (BestDist <= Tolerance * Tolerance) { return false; } // Collinear
+
+			// Furthest point from that plane
+
+			const FVector N = FVector::CrossProduct(Positions[OutSimplex[1]] - A, Positions[OutSimplex[2]] - A).GetSafeNormal();
+
+			BestDist = -1;
+			for (int i = 0; i < NumPositions; i++)
+			{
+				const double Dist = FMath::Abs(FVector::DotProduct(N, Positions[i] - A));
+				if (Dist <= BestDist) { continue; }
+				BestDist = Dist;
+				OutSimplex[3] = i;
+			}
+
+			return BestDist > Tolerance; // Coplanar otherwise
+		}
+	};
+}
@@ -53,13 +53,11 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExRelaxEdgeClustersContext : public FPCGExEdge
 	virtual ~FPCGExRelaxEdgeClustersContext() override;
 
 	int32 Iterations = 10;
-	int32 CurrentIteration = 0;
 	bool bUseLocalInfluence = false;
+	bool bProgressiveInfluence = true;
 	PCGEx::FLocalSingleFieldGetter* InfluenceGetter = nullptr;
 
-	TArray<FVector> OriginalBuffer;
-	TArray<FVector> PrimaryBuffer;
-	TArray<FVector> SecondaryBuffer;
+	TArray<FVector> RelaxedPositions; // Per-point result, written by each cluster task at its own (disjoint) point indices
 
 	UPCGExEdgeRelaxingOperation* Relaxing = nullptr;
 };
@@ -76,3 +74,18 @@ protected:
 	virtual bool Boot(FPCGContext* InContext) const override;
 	virtual bool ExecuteInternal(FPCGContext* InContext) const override;
 };
+
+class PCGEXTENDEDTOOLKIT_API FPCGExRelaxClusterTask : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExRelaxClusterTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
+	                       PCGExData::FPointIO* InEdgeIO) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
+		EdgeIO(InEdgeIO)
+	{
+	}
+
+	PCGExData::FPointIO* EdgeIO = nullptr;
+
+	virtual bool ExecuteTask() override;
+};
@@ -27,23 +27,12 @@ class PCGEXTENDEDTOOLKIT_API UPCGExEdgeRelaxingOperation : public UPCGExOperatio
 	GENERATED_BODY()
 
 public:
-	virtual void PrepareForPointIO(PCGExData::FPointIO& PointIO);
-	virtual void PrepareForCluster(PCGExData::FPointIO& EdgesIO, PCGExCluster::FCluster* InCluster);
-	virtual void PrepareForIteration(int Iteration, TArray<FVector>* PrimaryBuffer, TArray<FVector>* SecondaryBuffer);
-	virtual void ProcessVertex(const PCGExCluster::FNode& Vertex);
-
-	void ApplyInfluence(const PCGEx::FLocalSingleFieldGetter& Influence, TArray<FVector>* OverrideBuffer = nullptr) const;
-	virtual void WriteActiveBuffer(PCGExData::FPointIO& PointIO);
+	/**
+	 * Computes the relaxed position of a single node.
+	 * Buffers are indexed by node index; implementations must not rely on any mutable state
+	 * as every cluster is relaxed concurrently against the same operation.
+	 */
+	virtual FVector ProcessNode(const PCGExCluster::FCluster& Cluster, const PCGExCluster::FNode& Node, const TArray<FVector>& ReadBuffer) const;
 
 	double DefaultInfluence = 1;
-
-	virtual void Cleanup() override;
-
-protected:
-	int32 CurrentIteration = 0;
-	PCGExData::FPointIO* CurrentPoints = nullptr;
-	PCGExData::FPointIO* CurrentEdges = nullptr;
-	PCGExCluster::FCluster* CurrentCluster = nullptr;
-	TArray<FVector>* ReadBuffer = nullptr;
-	TArray<FVector>* WriteBuffer = nullptr;
 };
@@ -16,5 +16,5 @@ class PCGEXTENDEDTOOLKIT_API UPCGExLaplacianRelaxing : public UPCGExEdgeRelaxing
 	GENERATED_BODY()
 
 public:
-	virtual void ProcessVertex(const PCGExCluster::FNode& Vertex) override;
+	virtual FVector ProcessNode(const PCGExCluster::FCluster& Cluster, const PCGExCluster::FNode& Node, const TArray<FVector>& ReadBuffer) const override;
 };
@@ -11,7 +11,7 @@
 
 namespace PCGExGeo
 {
-	class TDelaunay3;
+	class TConvexHull3;
 }
 
 /**
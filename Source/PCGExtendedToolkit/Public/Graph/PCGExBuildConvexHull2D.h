@@ -12,7 +12,7 @@
 
 namespace PCGExGeo
 {
-	class TDelaunay2;
+	class TConvexHull2;
 }
 
 /**
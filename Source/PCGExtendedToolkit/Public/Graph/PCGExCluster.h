@@ -1,8 +1,10 @@
-// Copyright Timothé Lapetite 2024
+﻿// Copyright Timothé Lapetite 2024
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 
 #include "PCGExEdge.h"
@@ -59,6 +61,8 @@ namespace PCGExCluster
 	constexpr PCGExMT::AsyncState State_ProcessingCluster = __COUNTER__;
 	constexpr PCGExMT::AsyncState State_ProjectingCluster = __COUNTER__;
 
+	constexpr int64 GClusterCacheBudget = 256 * 1024 * 1024; // Max memory retained by the cluster cache
+
 	struct PCGEXTENDEDTOOLKIT_API FClusterItemRef
 	{
 		int32 ItemIndex;
@@ -102,39 +106,55 @@ namespace PCGExCluster
 
 	struct FCluster;
 
-	struct PCGEXTENDEDTOOLKIT_API FNode : public PCGExGraph::FNode
+	struct PCGEXTENDEDTOOLKIT_API FNode
 	{
-		FVector Position;
+		bool bValid = true;
 
-		TArray<int32> AdjacentNodes;
+		int32 NodeIndex = -1;  // Index in the cluster node list
+		int32 PointIndex = -1; // Index in the context of the UPCGPointData that helds the vtx
+		FVector Position = FVector::ZeroVector;
+
+		// Views into the owning cluster's adjacency (CSR) arrays; Edges[i] connects to AdjacentNodes[i]
+		TArrayView<const int32> AdjacentNodes;
+		TArrayView<const int32> Edges;
 
 		FNode()
 		{
-			PointIndex = -1;
-			Position = FVector::ZeroVector;
-			AdjacentNodes.Empty();
-			Edges.Empty();
 		}
 
-		~FNode();
-
-		void AddConnection(const int32 InEdgeIndex, const int32 InNodeIndex);
 		FVector GetCentroid(FCluster* InCluster) const;
 		int32 GetEdgeIndex(int32 AdjacentNodeIndex) const;
 	};
 
+	/**
+	 * Point index remapping & compressed adjacency of a cluster.
+	 * Immutable once built; copies of a cluster share it instead of duplicating it.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FClusterTopology
+	{
+		TMap<int32, int32> PointIndexMap; // Point index -> Node Index
+
+		// Compressed adjacency : neighbors of node N are stored in [AdjacencyOffsets[N], AdjacencyOffsets[N+1])
+		TArray<int32> AdjacencyOffsets;
+		TArray<int32> AdjacentNodeIndices;
+		TArray<int32> AdjacentEdgeIndices;
+
+		int64 GetAllocatedSize() const;
+	};
+
 	struct PCGEXTENDEDTOOLKIT_API FCluster
 	{
 		bool bEdgeLengthsDirty = true;
 		bool bValid = false;
 		int32 ClusterID = -1;
-		TMap<int32, int32> PointIndexMap; // Node index -> Point Index
-		TMap<uint64, int32> EdgeIndexMap; // Edge Hash -> Edge Index
 		TArray<FNode> Nodes;
 		TArray<PCGExGraph::FIndexedEdge> Edges;
 		TArray<double> EdgeLengths;
 		FBox Bounds;
 
+		TSharedPtr<const FClusterTopology> Topology;
+		TArray<FVector> NodePositions; // Node index -> Position
+
 		PCGExData::FPointIO* PointsIO = nullptr;
 		PCGExData::FPointIO* EdgesIO = nullptr;
 
@@ -144,6 +164,10 @@ namespace PCGExCluster
 
 		FCluster();
 
+		/** Copies per-node & per-edge data, sharing the topology of Other. Octrees are not copied. */
+		FCluster(const FCluster& Other);
+		FCluster& operator=(const FCluster&) = delete;
+
 		~FCluster();
 
 		bool BuildFrom(
@@ -152,7 +176,9 @@ namespace PCGExCluster
 			const TMap<int64, int32>& InNodeIndicesMap,
 			const TArray<int32>& PerNodeEdgeNums);
 
-		void BuildPartialFrom(const TArray<FVector>& Positions, const TSet<uint64>& InEdges);
+		/** Update node positions & bounds from (possibly moved) vtx points, keeping the topology. */
+		void RefreshPositions(const TArray<FPCGPoint>& InNodePoints);
+		int64 GetAllocatedSize() const;
 
 		void RebuildNodeOctree();
 		void RebuildEdgeOctree();
@@ -165,6 +191,14 @@ namespace PCGExCluster
 		int32 FindClosestNeighbor(const int32 NodeIndex, const FVector& Position, int32 MinNeighborCount = 1) const;
 		int32 FindClosestNeighbor(const int32 NodeIndex, const FVector& Position, const TSet<int32>& Exclusion, int32 MinNeighborCount = 1) const;
 
+		FORCEINLINE int32 GetNumNeighbors(const int32 NodeIndex) const { return Topology->AdjacencyOffsets[NodeIndex + 1] - Topology->AdjacencyOffsets[NodeIndex]; }
+		FORCEINLINE TArrayView<const int32> GetNeighbors(const int32 NodeIndex) const { return TArrayView<const int32>(Topology->AdjacentNodeIndices.GetData() + Topology->AdjacencyOffsets[NodeIndex], GetNumNeighbors(NodeIndex)); }
+		FORCEINLINE TArrayView<const int32> GetNeighborEdges(const int32 NodeIndex) const { return TArrayView<const int32>(Topology->AdjacentEdgeIndices.GetData() + Topology->AdjacencyOffsets[NodeIndex], GetNumNeighbors(NodeIndex)); }
+		FORCEINLINE const FVector& GetPos(const int32 NodeIndex) const { return NodePositions[NodeIndex]; }
+
+		/** Edge index connecting two nodes, or -1. Scans A's adjacency row; no hashing involved. */
+		int32 FindEdgeIndex(const int32 A, const int32 B) const;
+
 		const FNode& GetNodeFromPointIndex(const int32 Index) const;
 		const PCGExGraph::FIndexedEdge& GetEdgeFromNodeIndices(const int32 A, const int32 B) const;
 		void ComputeEdgeLengths(bool bNormalize = false);
@@ -178,9 +212,80 @@ namespace PCGExCluster
 		int32 FindClosestNeighborInDirection(const int32 NodeIndex, const FVector& Direction, int32 MinNeighborCount = 1) const;
 
 	protected:
-		FNode& GetOrCreateNode(const int32 PointIndex, const TArray<FPCGPoint>& InPoints);
+		FNode& GetOrCreateNode(FClusterTopology& InTopology, const int32 PointIndex, const TArray<FPCGPoint>& InPoints);
+
+		/** Build CSR adjacency from (StartNode, EndNode, EdgeIndex) triplets & bind node views to it. Parallel edges each keep their own entry. */
+		void CompileAdjacency(FClusterTopology& InTopology, const TArray<FIntVector>& Connections);
+	};
+
+	/**
+	 * Cache of built clusters, shared by every edges-processing node.
+	 * Entries are attached to the edges data they were built from : they are keyed by that data UID and a CRC of
+	 * the vtx/edge index mapping, and dropped as soon as the edges data is garbage collected.
+	 * A hit is checked against the current vtx mapping node by node, so a CRC collision is treated as a miss.
+	 * It shares the cached topology with the returned cluster; only per-node & per-edge data is copied,
+	 * and positions are refreshed from the current vtx.
+	 * Least recently used entries are evicted once the memory budget is exceeded.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FClusterCache
+	{
+	public:
+		static FClusterCache& Get();
+
+		/** Returns a new cluster sharing a cached topology, or nullptr if none matches. */
+		FCluster* TryGet(
+			const UPCGPointData* EdgesData,
+			const uint32 VtxTopologyCRC,
+			const TArray<FPCGPoint>& InNodePoints,
+			const TMap<int64, int32>& InNodeIndicesMap,
+			const TArray<int32>& PerNodeEdgeNums);
+
+		void Add(
+			const UPCGPointData* EdgesData,
+			const uint32 VtxTopologyCRC,
+			const FCluster& InCluster,
+			const TArray<FPCGPoint>& InNodePoints,
+			const TMap<int64, int32>& InNodeIndicesMap);
+
+		/** Drops entries whose edges data is no longer alive. */
+		void PurgeStale();
+		void Flush();
+
+		int64 MemoryBudget = GClusterCacheBudget;
+
+	protected:
+		struct FEntry
+		{
+			TWeakObjectPtr<const UPCGPointData> EdgesData;
+			TSharedPtr<const FCluster> Cluster;
+			TArray<int64> NodeVtxIds; // Vtx id each node was mapped from, per node index
+			int32 NumVtxPoints = 0;
+			int64 AllocatedSize = 0;
+			std::atomic<uint64> LastUsed{0};
+
+			bool Matches(const TArray<FPCGPoint>& InNodePoints, const TMap<int64, int32>& InNodeIndicesMap, const TArray<int32>& PerNodeEdgeNums) const;
+		};
+
+		mutable FRWLock CacheLock;
+		TMap<TPair<uint64, uint32>, TSharedPtr<FEntry>> Entries;
+		int64 UsedMemory = 0;
+		std::atomic<uint64> UseCounter{0};
+
+		/** Evicts least recently used entries in a single sorted pass. Expects the write lock to be held. */
+		void EvictToBudget();
 	};
 
+	/** Computes a CRC of everything cluster topology depends on, on the vtx side. */
+	PCGEXTENDEDTOOLKIT_API uint32 ComputeVtxTopologyCRC(const TMap<int64, int32>& InNodeIndicesMap, const TArray<int32>& PerNodeEdgeNums);
+
+	/** Fetch a matching cluster from the cache, or build & cache a new one. Returns nullptr for invalid clusters. */
+	PCGEXTENDEDTOOLKIT_API FCluster* GetOrBuildCluster(
+		const PCGExData::FPointIO& EdgeIO,
+		const TArray<FPCGPoint>& InNodePoints,
+		const TMap<int64, int32>& InNodeIndicesMap,
+		const TArray<int32>& PerNodeEdgeNums,
+		const uint32 VtxTopologyCRC);
+
 	struct PCGEXTENDEDTOOLKIT_API FNodeProjection
 	{
 		FNode* Node = nullptr;
@@ -56,6 +56,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExEdgesProcessorContext : public FPCGExPointsP
 	PCGExData::FPointIOTaggedEntries* TaggedEdges = nullptr;
 	TMap<int64, int32> NodeIndicesMap;
 	PCGEx::TFAttributeReader<int32>* EdgeNumReader = nullptr;
+	uint32 VtxTopologyCRC = 0;
 
 	virtual bool AdvancePointsIO() override;
 	bool AdvanceEdges(bool bBuildCluster); // Advance edges within current points
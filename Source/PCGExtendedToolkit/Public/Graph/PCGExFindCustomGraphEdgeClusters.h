@@ -74,9 +74,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExFindCustomGraphEdgeClustersContext : public
 
 	bool bInheritAttributes;
 
-	mutable FRWLock UniqueEdgesLock;
-	TSet<uint64> UniqueEdges;
-	TArray<PCGExGraph::FUnsignedEdge> Edges;
+	PCGExGraph::FEdgeBuffer EdgeBuffer;
 
 	FPCGExGraphBuilderSettings GraphBuilderSettings;
 	PCGExGraph::FGraphBuilder* GraphBuilder = nullptr;
@@ -210,62 +210,80 @@ namespace PCGExGraph
 		}
 	};
 
+	/**
+	 * Dense node metadata columns, indexed by node index.
+	 * Columns stay empty until something writes metadata, and are then sized to the whole graph.
+	 * Once sized, disjoint indices can be filled from parallel passes without locking.
+	 * Type is Unknown for nodes that never received metadata; nodes given metadata without an explicit type are PointEdge.
+	 */
 	struct PCGEXTENDEDTOOLKIT_API FGraphNodeMetadata
 	{
-		int32 NodeIndex;
-		EPCGExIntersectionType Type = EPCGExIntersectionType::PointEdge;
-		bool bCompounded = false; // Represents multiple nodes
-		int32 CompoundSize = 0;   // Fuse size
+		TArray<EPCGExIntersectionType> Type;
+		TArray<int32> CompoundSize; // Fuse size
 
-		explicit FGraphNodeMetadata(const int32 InNodeIndex)
-			: NodeIndex(InNodeIndex)
+		bool IsEmpty() const { return Type.IsEmpty(); }
+		int32 Num() const { return Type.Num(); }
+
+		/** Grows columns to at least InNum entries. Not thread-safe. */
+		void Grow(const int32 InNum)
 		{
+			if (InNum <= Type.Num()) { return; }
+			Type.SetNumZeroed(InNum);
+			CompoundSize.SetNumZeroed(InNum);
 		}
 
-		bool IsIntersector() const { return Type == EPCGExIntersectionType::PointEdge; }
-		bool IsCrossing() const { return Type == EPCGExIntersectionType::EdgeEdge; }
+		bool IsCompounded(const int32 NodeIndex) const { return CompoundSize.IsValidIndex(NodeIndex) && CompoundSize[NodeIndex] > 1; }
+		int32 GetCompoundSize(const int32 NodeIndex) const { return CompoundSize.IsValidIndex(NodeIndex) ? CompoundSize[NodeIndex] : 0; }
+		bool IsIntersector(const int32 NodeIndex) const { return Type.IsValidIndex(NodeIndex) && Type[NodeIndex] == EPCGExIntersectionType::PointEdge; }
+		bool IsCrossing(const int32 NodeIndex) const { return Type.IsValidIndex(NodeIndex) && Type[NodeIndex] == EPCGExIntersectionType::EdgeEdge; }
 
-		static FGraphNodeMetadata* GetOrCreate(const int32 NodeIndex, TMap<int32, FGraphNodeMetadata*>& InMetadata)
+		void Empty()
 		{
-			if (FGraphNodeMetadata** MetadataPtr = InMetadata.Find(NodeIndex)) { return *MetadataPtr; }
-
-			FGraphNodeMetadata* NewMetadata = new FGraphNodeMetadata(NodeIndex);
-			InMetadata.Add(NodeIndex, NewMetadata);
-			return NewMetadata;
+			Type.Empty();
+			CompoundSize.Empty();
 		}
 	};
 
+	/**
+	 * Dense edge metadata columns, indexed by edge index. See FGraphNodeMetadata.
+	 */
 	struct PCGEXTENDEDTOOLKIT_API FGraphEdgeMetadata
 	{
-		int32 EdgeIndex;
-		int32 ParentIndex;
-		EPCGExIntersectionType Type = EPCGExIntersectionType::Unknown;
+		TArray<int32> ParentIndex; // Edge this one was split from, -1 if none
+		TArray<EPCGExIntersectionType> Type;
+
+		bool IsEmpty() const { return Type.IsEmpty(); }
+		int32 Num() const { return Type.Num(); }
 
-		explicit FGraphEdgeMetadata(const int32 InEdgeIndex, const int32 InParentIndex)
-			: EdgeIndex(InEdgeIndex), ParentIndex(InParentIndex)
+		/** Grows columns to at least InNum entries. Not thread-safe. */
+		void Grow(const int32 InNum)
 		{
+			const int32 StartNum = Type.Num();
+			if (InNum <= StartNum) { return; }
+			Type.SetNumZeroed(InNum);
+			ParentIndex.SetNumUninitialized(InNum);
+			for (int i = StartNum; i < InNum; i++) { ParentIndex[i] = -1; }
 		}
 
-		static FGraphEdgeMetadata* GetOrCreate(const int32 EdgeIndex, const int32 ParentIndex, TMap<int32, FGraphEdgeMetadata*>& InMetadata)
+		/** Registers EdgeIndex as split from ParentEdgeIndex, growing columns as needed. Not thread-safe. */
+		void Set(const int32 EdgeIndex, const int32 ParentEdgeIndex, const EPCGExIntersectionType InType)
 		{
-			if (FGraphEdgeMetadata** MetadataPtr = InMetadata.Find(EdgeIndex)) { return *MetadataPtr; }
-
-			FGraphEdgeMetadata* NewMetadata = new FGraphEdgeMetadata(EdgeIndex, ParentIndex);
-			InMetadata.Add(EdgeIndex, NewMetadata);
-			return NewMetadata;
+			Grow(EdgeIndex + 1);
+			ParentIndex[EdgeIndex] = ParentEdgeIndex;
+			Type[EdgeIndex] = InType;
 		}
 
-		static int32 GetRootIndex(const int32 EdgeIndex, TMap<int32, FGraphEdgeMetadata*>& InMetadata)
+		int32 GetRootIndex(const int32 EdgeIndex) const
 		{
-			int32 ParentIndex = -1;
-			FGraphEdgeMetadata** Parent = InMetadata.Find(EdgeIndex);
-			while (Parent)
-			{
-				ParentIndex = (*Parent)->EdgeIndex;
-				Parent = InMetadata.Find(EdgeIndex);
-			}
+			int32 RootIndex = EdgeIndex;
+			while (ParentIndex.IsValidIndex(RootIndex) && ParentIndex[RootIndex] != -1) { RootIndex = ParentIndex[RootIndex]; }
+			return RootIndex;
+		}
 
-			return ParentIndex == -1 ? EdgeIndex : ParentIndex;
+		void Empty()
+		{
+			ParentIndex.Empty();
+			Type.Empty();
 		}
 	};
 
@@ -316,6 +334,63 @@ namespace PCGExGraph
 		int32 GetFirstInIOIndex();
 	};
 
+	/**
+	 * Set of edge hashes split across independently locked shards.
+	 * Concurrent inserters only contend when their edges land in the same shard.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FEdgeHashSet
+	{
+	public:
+		static constexpr int32 NumShards = 64;
+
+		/** Returns true if the hash wasn't in the set yet. */
+		bool Add(const uint64 Hash);
+		bool Contains(const uint64 Hash) const;
+
+		void Reserve(const int32 InNum);
+		void Empty();
+		int32 Num() const;
+
+	protected:
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+		{
+			mutable FRWLock Lock;
+			TSet<uint64> Hashes;
+		};
+
+		FShard Shards[NumShards];
+
+		static int32 GetShardIndex(const uint64 Hash) { return static_cast<int32>((Hash * 0x9E3779B97F4A7C15ULL) >> 58); }
+	};
+
+	/**
+	 * Concurrent edge insertion front-end.
+	 * Producers append raw, possibly duplicated directed edges to a slot picked from their thread id;
+	 * dedup happens once, in bulk, when the buffer is handed to FGraph::InsertEdges, and kept edges retain their Start -> End direction.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FEdgeBuffer
+	{
+	public:
+		static constexpr int32 NumSlots = 32;
+
+		void Add(const int32 A, const int32 B) { Add(PCGEx::H64(A, B)); }
+		void Add(const uint64 Hash);
+
+		int32 Num() const;
+
+		/** Moves every buffered hash into OutHashes and resets the buffer. Not thread-safe. */
+		void Drain(TArray<uint64>& OutHashes);
+
+	protected:
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FSlot
+		{
+			FRWLock Lock;
+			TArray<uint64> Hashes;
+		};
+
+		FSlot Slots[NumSlots];
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FGraph
 	{
 		mutable FRWLock GraphLock;
@@ -325,12 +400,12 @@ namespace PCGExGraph
 		bool bRequiresConsolidation = false;
 
 		TArray<FNode> Nodes;
-		TMap<int32, FGraphNodeMetadata*> NodeMetadata;
-		TMap<int32, FGraphEdgeMetadata*> EdgeMetadata;
+		FGraphNodeMetadata NodeMetadata;
+		FGraphEdgeMetadata EdgeMetadata;
 
 		TArray<FIndexedEdge> Edges;
 
-		TSet<uint64> UniqueEdges;
+		FEdgeHashSet UniqueEdges;
 
 		TArray<FSubGraph*> SubGraphs;
 
@@ -357,6 +432,7 @@ namespace PCGExGraph
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		void InsertEdges(const TArray<FUnsignedEdge>& InEdges, int32 InIOIndex);
 		void InsertEdges(const TArray<FIndexedEdge>& InEdges);
+		void InsertEdges(FEdgeBuffer& InBuffer, int32 InIOIndex);
 
 		TArrayView<FNode> AddNodes(const int32 NumNewNodes);
 
@@ -373,8 +449,8 @@ namespace PCGExGraph
 
 		~FGraph()
 		{
-			PCGEX_DELETE_TMAP(NodeMetadata, int32)
-			PCGEX_DELETE_TMAP(EdgeMetadata, int32)
+			NodeMetadata.Empty();
+			EdgeMetadata.Empty();
 
 			Nodes.Empty();
 			UniqueEdges.Empty();
@@ -385,6 +461,15 @@ namespace PCGExGraph
 		}
 
 		void GetConnectedNodes(int32 FromIndex, TArray<int32>& OutIndices, int32 SearchDepth) const;
+
+	protected:
+		/**
+		 * Bulk insertion shared by all InsertEdges overloads.
+		 * Candidates are radix-sorted by hash to drop duplicates, filtered against existing edges,
+		 * appended in input order, and node adjacency is then extended in a single CSR pass.
+		 */
+		template <typename FGetHash, typename FInitEdge>
+		void InsertEdgesBulk(const int32 NumCandidates, FGetHash&& GetHash, FInitEdge&& InitEdge);
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FGraphBuilder
@@ -466,7 +551,6 @@ namespace PCGExGraph
 	{
 		const FPCGPoint Point;
 		FVector Center;
-		FBoxSphereBounds Bounds;
 		int32 Index;
 
 		TArray<int32> Neighbors; // PointIO Index >> Edge Index
@@ -477,7 +561,6 @@ namespace PCGExGraph
 			  Index(InIndex)
 		{
 			Neighbors.Empty();
-			Bounds = FBoxSphereBounds(InPoint.GetLocalBounds().TransformBy(InPoint.Transform));
 		}
 
 		~FCompoundNode()
@@ -490,34 +573,78 @@ namespace PCGExGraph
 		FVector UpdateCenter(const PCGExData::FIdxCompoundList* PointsCompounds, PCGExData::FPointIOCollection* IOGroup);
 	};
 
-	struct PCGEXTENDEDTOOLKIT_API FCompoundNodeSemantics
+	/**
+	 * Uniform spatial hash shared by the compound graph fuse paths.
+	 * Cells are at least as large as the fuse tolerance, so candidates are always within SearchRadius cells.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FFuseGridSpace
 	{
-		enum { MaxElementsPerLeaf = 16 };
-
-		enum { MinInclusiveElementsPerNode = 7 };
+		static constexpr int32 CellBits = 21;
+		static constexpr int64 CellMask = (1LL << CellBits) - 1;
 
-		enum { MaxNodeDepth = 12 };
+		FVector Origin = FVector::ZeroVector;
+		double CellSize = 1;
 
-		using ElementAllocator = TInlineAllocator<MaxElementsPerLeaf>;
+		FFuseGridSpace()
+		{
+		}
 
-		FORCEINLINE static const FBoxSphereBounds& GetBoundingBox(const FCompoundNode* InNode)
+		FFuseGridSpace(const FBox& InBounds, const double InMinCellSize)
+			: Origin(InBounds.Min),
+			  CellSize(FMath::Max(InMinCellSize, (InBounds.GetSize().GetMax() + 2) / static_cast<double>(CellMask - 2)))
 		{
-			return InNode->Bounds;
+			// One cell of margin, so that neighbors of any clamped coordinate remain addressable
+			Origin -= FVector(CellSize);
 		}
 
-		FORCEINLINE static const bool AreElementsEqual(const FCompoundNode* A, const FCompoundNode* B)
+		FIntVector GetCoords(const FVector& Position) const
 		{
-			return A == B;
+			const FVector Local = (Position - Origin) / CellSize;
+			return FIntVector(
+				FMath::Clamp(FMath::FloorToInt(Local.X), 1, static_cast<int32>(CellMask) - 1),
+				FMath::Clamp(FMath::FloorToInt(Local.Y), 1, static_cast<int32>(CellMask) - 1),
+				FMath::Clamp(FMath::FloorToInt(Local.Z), 1, static_cast<int32>(CellMask) - 1));
 		}
 
-		FORCEINLINE static void ApplyOffset(FCompoundNode& InNode)
+		static uint64 GetKey(const FIntVector& Coords)
 		{
-			ensureMsgf(false, TEXT("Not implemented"));
+			return static_cast<uint64>(Coords.X) << (CellBits * 2) |
+				static_cast<uint64>(Coords.Y) << CellBits |
+				static_cast<uint64>(Coords.Z);
 		}
 
-		FORCEINLINE static void SetElementId(const FCompoundNode* Element, FOctreeElementId2 OctreeElementID)
+		uint64 GetKey(const FVector& Position) const { return GetKey(GetCoords(Position)); }
+	};
+
+	/**
+	 * Order-independent bulk point fusing.
+	 * Sources are bucketed into grid cells with a radix sort, and sorted by position within each cell.
+	 * Anchors are then elected cell by cell over 27 interleaved phases (one per cell coordinate modulo 3),
+	 * so cells processed concurrently never see each other's anchors. Each source joins its closest anchor
+	 * within tolerance; ties go to the first anchor in scan order. The result only depends on the sources,
+	 * not on scheduling nor on input order.
+	 *
+	 * Output is a SoA compound index: nodes are contiguous per cell, and node N owns
+	 * Members[NodeOffsets[N] .. NodeOffsets[N+1]), as H64(IOIndex, PointIndex).
+	 */
+	class PCGEXTENDEDTOOLKIT_API FFuseGrid
+	{
+	public:
+		explicit FFuseGrid(const FPCGExFuseSettings& InFuseSettings)
+			: FuseSettings(InFuseSettings)
 		{
 		}
+
+		void Fuse(const TArray<PCGExData::FPointIO*>& InSources);
+
+		int32 NumNodes() const { return Anchors.Num(); }
+
+		TArray<uint64> Anchors; // Source elected for each node
+		TArray<uint64> Members;
+		TArray<int32> NodeOffsets;
+
+	protected:
+		const FPCGExFuseSettings& FuseSettings;
 	};
 
 	struct PCGEXTENDEDTOOLKIT_API FCompoundGraph
@@ -529,18 +656,16 @@ namespace PCGExGraph
 		const FPCGExFuseSettings FuseSettings;
 
 		FBox Bounds;
-		using NodeOctree = TOctree2<FCompoundNode*, FCompoundNodeSemantics>;
-		mutable NodeOctree Octree;
-		mutable FRWLock OctreeLock;
 
 		explicit FCompoundGraph(const FPCGExFuseSettings& InFuseSettings, const FBox& InBounds)
-			: FuseSettings(InFuseSettings), Bounds(InBounds)
+			: FuseSettings(InFuseSettings), Bounds(InBounds),
+			  GridSpace(InBounds, InFuseSettings.Tolerance)
 		{
 			Nodes.Empty();
 			Edges.Empty();
 			PointsCompounds = new PCGExData::FIdxCompoundList();
 			EdgesCompounds = new PCGExData::FIdxCompoundList();
-			Octree = NodeOctree(Bounds.GetCenter(), Bounds.GetExtent().Length());
+			bSpatializedDistance = FuseSettings.SourceDistance != EPCGExDistance::Center || FuseSettings.TargetDistance != EPCGExDistance::Center;
 		}
 
 		~FCompoundGraph()
@@ -549,11 +674,18 @@ namespace PCGExGraph
 			PCGEX_DELETE(PointsCompounds)
 			PCGEX_DELETE(EdgesCompounds)
 			Edges.Empty();
+			GridCells.Empty();
 		}
 
 		int32 NumNodes() const { return PointsCompounds->Num(); }
 		int32 NumEdges() const { return EdgesCompounds->Num(); }
 
+		/**
+		 * Fuses every point of the given sources at once, deterministically. See FFuseGrid.
+		 * Meant to populate an empty graph; nodes are indexed for incremental queries lazily.
+		 */
+		void InsertPoints(const TArray<PCGExData::FPointIO*>& InSources);
+
 		FCompoundNode* GetOrCreateNode(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
 		FCompoundNode* GetOrCreateNodeUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
 		PCGExData::FIdxCompound* CreateBridge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
@@ -563,7 +695,20 @@ namespace PCGExGraph
 		                                            const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
 		                                            const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
 		void GetUniqueEdges(TArray<FUnsignedEdge>& OutEdges);
-		void WriteMetadata(TMap<int32, FGraphNodeMetadata*>& OutMetadata);
+		void WriteMetadata(FGraphNodeMetadata& OutMetadata);
+
+	protected:
+		FFuseGridSpace GridSpace;
+		TMap<uint64, TArray<int32, TInlineAllocator<4>>> GridCells;
+		int32 NumGridNodes = 0;
+		bool bSpatializedDistance = false;
+		double MaxNodeExtent = 0;
+		mutable FRWLock GridLock;
+
+		int32 FindNode(const FPCGPoint& Point) const;
+		FCompoundNode* CreateNode(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
+		void IndexPendingNodes();
+		void GrowGrid();
 	};
 
 #pragma endregion
@@ -634,9 +779,15 @@ namespace PCGExGraph
 		bool FindSplit(const FVector& Position, FPESplit& OutSplit) const;
 	};
 
+	/**
+	 * Point/edge intersections.
+	 * Valid nodes are bucketed once into a uniform grid sized from the point density, stored as cells sorted by key.
+	 * Each edge then walks the cells its segment crosses with a 3D DDA, padded by one cell on every side, so the cost
+	 * follows edge length in cells rather than the size of its bounds.
+	 * Each edge only ever writes its own splits, so edges can be processed concurrently without locking.
+	 */
 	struct PCGEXTENDEDTOOLKIT_API FPointEdgeIntersections
 	{
-		mutable FRWLock InsertionLock;
 		PCGExData::FPointIO* PointIO = nullptr;
 		FGraph* Graph = nullptr;
 		FCompoundGraph* CompoundGraph = nullptr;
@@ -652,13 +803,26 @@ namespace PCGExGraph
 
 		void FindIntersections(FPCGExPointsProcessorContext* InContext);
 
+		/** Gathers nodes that may lie on the given edge, ordered by cell then node index. */
+		void GetCandidateNodes(const FPointEdgeProxy& Edge, TArray<int32>& OutNodes) const;
+
+		/** Records a split on EdgeIndex. Only the task processing EdgeIndex may call this. */
 		void Add(const int32 EdgeIndex, const FPESplit& Split);
 		void Insert();
 
 		~FPointEdgeIntersections()
 		{
 			Edges.Empty();
+			CellKeys.Empty();
+			CellOffsets.Empty();
+			CellNodes.Empty();
 		}
+
+	protected:
+		FFuseGridSpace GridSpace;
+		TArray<uint64> CellKeys;  // Sorted, unique
+		TArray<int32> CellOffsets; // Cell N owns CellNodes[CellOffsets[N] .. CellOffsets[N+1])
+		TArray<int32> CellNodes;
 	};
 
 	static void FindCollinearNodes(
@@ -672,95 +836,39 @@ namespace PCGExGraph
 		const FIndexedEdge& IEdge = InIntersections->Graph->Edges[EdgeIndex];
 		FPESplit Split = FPESplit{};
 
-		if (!InIntersections->Settings.bEnableSelfIntersection)
-		{
-			TArray<int32> IOIndices;
-			InIntersections->CompoundGraph->EdgesCompounds->GetIOIndices(
-				FGraphEdgeMetadata::GetRootIndex(Edge.EdgeIndex, InIntersections->Graph->EdgeMetadata), IOIndices);
-
-			auto ProcessPointRef = [&](const FPCGPointRef& PointRef)
-			{
-				const ptrdiff_t PointIndex = PointRef.Point - Points.GetData();
-
-				if (!Points.IsValidIndex(static_cast<int32>(PointIndex))) { return; }
-				const FNode& Node = InIntersections->Graph->Nodes[PointIndex];
+		TArray<int32> Candidates;
+		InIntersections->GetCandidateNodes(Edge, Candidates);
 
-				if (!Node.bValid) { return; }
+		TArray<int32> IOIndices;
+		bool bIOIndicesFetched = InIntersections->Settings.bEnableSelfIntersection;
 
-				const FVector Position = Points[Node.PointIndex].Transform.GetLocation();
-
-				if (!Edge.Box.IsInside(Position)) { return; }
-				if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { return; }
-				if (!Edge.FindSplit(Position, Split)) { return; }
+		for (const int32 NodeIndex : Candidates)
+		{
+			const FNode& Node = InIntersections->Graph->Nodes[NodeIndex];
 
-				// Check overlap last as it's the most expensive op
-				if (InIntersections->CompoundGraph->PointsCompounds->HasIOIndexOverlap(Node.NodeIndex, IOIndices)) { return; }
+			if (!Points.IsValidIndex(Node.PointIndex)) { continue; }
+			if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { continue; }
 
-				Split.NodeIndex = Node.NodeIndex;
-				InIntersections->Add(EdgeIndex, Split);
-			};
+			const FVector Position = Points[Node.PointIndex].Transform.GetLocation();
 
-			PointsData->GetOctree().FindElementsWithBoundsTest(Edge.Box, ProcessPointRef);
+			if (!Edge.Box.IsInside(Position)) { continue; }
+			if (!Edge.FindSplit(Position, Split)) { continue; }
 
-			/*
-			for (const FNode& Node : InIntersections->Graph->Nodes)
+			if (!InIntersections->Settings.bEnableSelfIntersection)
 			{
-				if (!Node.bValid) { continue; }
-
-				FVector Position = Points[Node.PointIndex].Transform.GetLocation();
-
-				if (!Edge.Box.IsInside(Position)) { continue; }
-				if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { continue; }
-				if (!Edge.FindSplit(Position, Split)) { continue; }
+				if (!bIOIndicesFetched)
+				{
+					InIntersections->CompoundGraph->EdgesCompounds->GetIOIndices(
+						InIntersections->Graph->EdgeMetadata.GetRootIndex(Edge.EdgeIndex), IOIndices);
+					bIOIndicesFetched = true;
+				}
 
 				// Check overlap last as it's the most expensive op
 				if (InIntersections->CompoundGraph->PointsCompounds->HasIOIndexOverlap(Node.NodeIndex, IOIndices)) { continue; }
-
-				Split.NodeIndex = Node.NodeIndex;
-				InIntersections->Add(EdgeIndex, Split);
 			}
-			*/
-		}
-		else
-		{
-			auto ProcessPointRef = [&](const FPCGPointRef& PointRef)
-			{
-				const ptrdiff_t PointIndex = PointRef.Point - Points.GetData();
-
-				if (!Points.IsValidIndex(static_cast<int32>(PointIndex))) { return; }
-				const FNode& Node = InIntersections->Graph->Nodes[PointIndex];
-
-				if (!Node.bValid) { return; }
 
-				const FVector Position = Points[Node.PointIndex].Transform.GetLocation();
-
-				if (!Edge.Box.IsInside(Position)) { return; }
-				if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { return; }
-				if (Edge.FindSplit(Position, Split))
-				{
-					Split.NodeIndex = Node.NodeIndex;
-					InIntersections->Add(EdgeIndex, Split);
-				}
-			};
-
-			PointsData->GetOctree().FindElementsWithBoundsTest(Edge.Box, ProcessPointRef);
-
-			/*
-			for (const FNode& Node : InIntersections->Graph->Nodes)
-			{
-				if (!Node.bValid) { continue; }
-
-				FVector Position = Points[Node.PointIndex].Transform.GetLocation();
-
-				if (!Edge.Box.IsInside(Position)) { continue; }
-				if (IEdge.Start == Node.PointIndex || IEdge.End == Node.PointIndex) { continue; }
-				if (Edge.FindSplit(Position, Split))
-				{
-					Split.NodeIndex = Node.NodeIndex;
-					InIntersections->Add(EdgeIndex, Split);
-				}
-			}
-			*/
+			Split.NodeIndex = Node.NodeIndex;
+			InIntersections->Add(EdgeIndex, Split);
 		}
 	}
 
@@ -796,11 +904,11 @@ namespace PCGExGraph
 	{
 		int32 EdgeIndex = -1;
 		TArray<FEECrossing*> Intersections;
+		TArray<FEECrossing> OwnedCrossings; // Crossings found while querying from this edge, written by its owner only
 
 		double LengthSquared = -1;
 		double ToleranceSquared = -1;
 		FBox Box = FBox(NoInit);
-		FBoxSphereBounds FSBounds = FBoxSphereBounds{};
 
 		FVector Start = FVector::ZeroVector;
 		FVector End = FVector::ZeroVector;
@@ -825,6 +933,7 @@ namespace PCGExGraph
 			const double Tolerance)
 		{
 			Intersections.Empty();
+			OwnedCrossings.Empty();
 
 			Start = InStart;
 			End = InEnd;
@@ -838,50 +947,81 @@ namespace PCGExGraph
 			Box = Box.ExpandBy(Tolerance);
 
 			LengthSquared = FVector::DistSquared(Start, End);
-			FSBounds = Box;
 		}
 
 		~FEdgeEdgeProxy()
 		{
 			Intersections.Empty();
+			OwnedCrossings.Empty();
 		}
 
 		bool FindSplit(const FEdgeEdgeProxy& OtherEdge, FEESplit& OutSplit) const;
 	};
 
-	struct PCGEXTENDEDTOOLKIT_API FEdgeEdgeProxySemantics
+	/**
+	 * Static bounding volume hierarchy over edge proxies.
+	 * Edges are sorted along a morton curve and grouped into fixed-size leaves; each upper level
+	 * pairs consecutive nodes of the level below, so the tree is implicit and only stores bounds.
+	 * Queries only report edges that come after the querying one in morton order, which gives
+	 * every candidate pair a single owner and lets all edges be queried concurrently without bookkeeping.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FEdgeBVH
 	{
-		enum { MaxElementsPerLeaf = 16 };
-
-		enum { MinInclusiveElementsPerNode = 7 };
+		static constexpr int32 LeafSize = 8;
 
-		enum { MaxNodeDepth = 12 };
+		TArray<int32> Order;     // Edge indices, in morton order
+		TArray<int32> Positions; // Position of each edge in Order, -1 if it's not part of the hierarchy
+		TArray<FBox> NodeBounds; // All levels, leaves first
+		TArray<int32> LevelOffsets;
 
-		using ElementAllocator = TInlineAllocator<MaxElementsPerLeaf>;
+		void Build(const TArray<FEdgeEdgeProxy>& Proxies);
 
-		FORCEINLINE static const FBoxSphereBounds& GetBoundingBox(const FEdgeEdgeProxy* InEdge)
+		template <typename Func>
+		void ForEachOverlapAfter(const FEdgeEdgeProxy& Proxy, Func&& Callback) const
 		{
-			return InEdge->FSBounds;
-		}
+			if (LevelOffsets.IsEmpty() || !Positions.IsValidIndex(Proxy.EdgeIndex)) { return; }
 
-		FORCEINLINE static const bool AreElementsEqual(const FEdgeEdgeProxy* A, const FEdgeEdgeProxy* B)
-		{
-			return A == B;
-		}
+			const int32 First = Positions[Proxy.EdgeIndex] + 1;
+			const int32 NumItems = Order.Num();
+			if (First <= 0 || First >= NumItems) { return; }
 
-		FORCEINLINE static void ApplyOffset(FEdgeEdgeProxy& InEdge)
-		{
-			ensureMsgf(false, TEXT("Not implemented"));
+			TArray<FIntPoint, TInlineAllocator<64>> Stack; // X = Level, Y = Node index within level
+			Stack.Emplace(LevelOffsets.Num() - 1, 0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FIntPoint Node = Stack.Pop(false);
+				const int32 RangeEnd = FMath::Min(((Node.Y + 1) << Node.X) * LeafSize, NumItems);
+
+				if (RangeEnd <= First) { continue; }
+				if (!NodeBounds[LevelOffsets[Node.X] + Node.Y].Intersect(Proxy.Box)) { continue; }
+
+				if (Node.X == 0)
+				{
+					for (int i = FMath::Max(First, Node.Y * LeafSize); i < RangeEnd; i++) { Callback(Order[i]); }
+					continue;
+				}
+
+				const int32 ChildLevel = Node.X - 1;
+				const int32 NumChildren = LevelOffsets[Node.X] - LevelOffsets[ChildLevel];
+				const int32 Left = Node.Y * 2;
+
+				if (Left + 1 < NumChildren) { Stack.Emplace(ChildLevel, Left + 1); }
+				Stack.Emplace(ChildLevel, Left);
+			}
 		}
 
-		FORCEINLINE static void SetElementId(const FEdgeEdgeProxy* Element, FOctreeElementId2 OctreeElementID)
+		void Empty()
 		{
+			Order.Empty();
+			Positions.Empty();
+			NodeBounds.Empty();
+			LevelOffsets.Empty();
 		}
 	};
 
 	struct PCGEXTENDEDTOOLKIT_API FEdgeEdgeIntersections
 	{
-		mutable FRWLock InsertionLock;
 		PCGExData::FPointIO* PointIO = nullptr;
 		FGraph* Graph = nullptr;
 		FCompoundGraph* CompoundGraph = nullptr;
@@ -890,10 +1030,8 @@ namespace PCGExGraph
 
 		TArray<FEECrossing*> Crossings;
 		TArray<FEdgeEdgeProxy> Edges;
-		TSet<uint64> CheckedPairs;
 
-		using TEdgeOctree = TOctree2<FEdgeEdgeProxy*, FEdgeEdgeProxySemantics>;
-		mutable TEdgeOctree Octree;
+		FEdgeBVH BVH;
 
 		FEdgeEdgeIntersections(
 			FGraph* InGraph,
@@ -903,12 +1041,13 @@ namespace PCGExGraph
 
 		void FindIntersections(FPCGExPointsProcessorContext* InContext);
 
+		/** Records a crossing owned by EdgeIndex. Only the task querying EdgeIndex may call this. */
 		void Add(const int32 EdgeIndex, const int32 OtherEdgeIndex, const FEESplit& Split);
 		void Insert();
 
 		~FEdgeEdgeIntersections()
 		{
-			CheckedPairs.Empty();
+			BVH.Empty();
 			Edges.Empty();
 			PCGEX_DELETE_TARRAY(Crossings)
 		}
@@ -926,94 +1065,40 @@ namespace PCGExGraph
 		if (!InIntersections->Settings.bEnableSelfIntersection)
 		{
 			TArray<int32> IOIndices;
-			InIntersections->CompoundGraph->EdgesCompounds->GetIOIndices(
-				FGraphEdgeMetadata::GetRootIndex(Edge.EdgeIndex, InIntersections->Graph->EdgeMetadata), IOIndices);
+			bool bIOIndicesFetched = false;
 
-			auto ProcessEdge = [&](const FEdgeEdgeProxy* Proxy)
+			auto ProcessEdge = [&](const int32 OtherEdgeIndex)
 			{
-				const FEdgeEdgeProxy& OtherEdge = *Proxy;
+				const FEdgeEdgeProxy& OtherEdge = InIntersections->Edges[OtherEdgeIndex];
 
-				if (OtherEdge.EdgeIndex == -1 || &Edge == &OtherEdge) { return; }
-				if (!Edge.Box.Intersect(OtherEdge.Box)) { return; }
+				if (!Edge.FindSplit(OtherEdge, Split)) { return; }
 
+				if (!bIOIndicesFetched)
 				{
-					FReadScopeLock ReadLock(InIntersections->InsertionLock);
-					if (InIntersections->CheckedPairs.Contains(PCGEx::H64U(EdgeIndex, OtherEdge.EdgeIndex))) { return; }
+					InIntersections->CompoundGraph->EdgesCompounds->GetIOIndices(
+						InIntersections->Graph->EdgeMetadata.GetRootIndex(Edge.EdgeIndex), IOIndices);
+					bIOIndicesFetched = true;
 				}
 
-				if (!Edge.FindSplit(OtherEdge, Split)) { return; }
-
 				// Check overlap last as it's the most expensive op
 				if (InIntersections->CompoundGraph->EdgesCompounds->HasIOIndexOverlap(
-					FGraphEdgeMetadata::GetRootIndex(OtherEdge.EdgeIndex, InIntersections->Graph->EdgeMetadata),
+					InIntersections->Graph->EdgeMetadata.GetRootIndex(OtherEdge.EdgeIndex),
 					IOIndices)) { return; }
 
 				InIntersections->Add(EdgeIndex, OtherEdge.EdgeIndex, Split);
 			};
 
-			InIntersections->Octree.FindElementsWithBoundsTest(Edge.Box, ProcessEdge);
-
-			/*
-			for (const FEdgeEdgeProxy& OtherEdge : InIntersections->Edges)
-			{
-				if (OtherEdge.EdgeIndex == -1 || &Edge == &OtherEdge) { continue; }
-				if (!Edge.Box.Intersect(OtherEdge.Box)) { continue; }
-
-				{
-					FReadScopeLock ReadLock(InIntersections->InsertionLock);
-					if (InIntersections->CheckedPairs.Contains(PCGEx::H64U(EdgeIndex, OtherEdge.EdgeIndex))) { continue; }
-				}
-
-				if (!Edge.FindSplit(OtherEdge, Split)) { continue; }
-
-				// Check overlap last as it's the most expensive op
-				if (InIntersections->CompoundGraph->EdgesCompounds->HasIOIndexOverlap(
-					FGraphEdgeMetadata::GetRootIndex(OtherEdge.EdgeIndex, InIntersections->Graph->EdgeMetadata),
-					IOIndices)) { continue; }
-
-				InIntersections->Add(EdgeIndex, OtherEdge.EdgeIndex, Split);
-			}
-			*/
+			InIntersections->BVH.ForEachOverlapAfter(Edge, ProcessEdge);
 		}
 		else
 		{
-			auto ProcessEdge = [&](const FEdgeEdgeProxy* Proxy)
+			auto ProcessEdge = [&](const int32 OtherEdgeIndex)
 			{
-				const FEdgeEdgeProxy& OtherEdge = *Proxy;
-
-				if (OtherEdge.EdgeIndex == -1 || &Edge == &OtherEdge) { return; }
-				if (!Edge.Box.Intersect(OtherEdge.Box)) { return; }
-
-				{
-					FReadScopeLock ReadLock(InIntersections->InsertionLock);
-					if (InIntersections->CheckedPairs.Contains(PCGEx::H64U(EdgeIndex, OtherEdge.EdgeIndex))) { return; }
-				}
-
-				if (Edge.FindSplit(OtherEdge, Split))
-				{
-					InIntersections->Add(EdgeIndex, OtherEdge.EdgeIndex, Split);
-				}
+				const FEdgeEdgeProxy& OtherEdge = InIntersections->Edges[OtherEdgeIndex];
+				if (Edge.FindSplit(OtherEdge, Split)) { InIntersections->Add(EdgeIndex, OtherEdge.EdgeIndex, Split); }
 			};
 
-			InIntersections->Octree.FindElementsWithBoundsTest(Edge.Box, ProcessEdge);
-
-			/*
-			for (const FEdgeEdgeProxy& OtherEdge : InIntersections->Edges)
-			{
-				if (OtherEdge.EdgeIndex == -1 || &Edge == &OtherEdge) { continue; }
-				if (!Edge.Box.Intersect(OtherEdge.Box)) { continue; }
-
-				{
-					FReadScopeLock ReadLock(InIntersections->InsertionLock);
-					if (InIntersections->CheckedPairs.Contains(PCGEx::H64U(EdgeIndex, OtherEdge.EdgeIndex))) { continue; }
-				}
-
-				if (Edge.FindSplit(OtherEdge, Split))
-				{
-					InIntersections->Add(EdgeIndex, OtherEdge.EdgeIndex, Split);
-				}
-			}
-			*/
+			InIntersections->BVH.ForEachOverlapAfter(Edge, ProcessEdge);
 		}
 	}
 
@@ -1147,14 +1232,14 @@ namespace PCGExGraphTask
 	{
 	public:
 		FInsertEdgeEdgeIntersections(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
-		                             PCGExGraph::FEdgeEdgeIntersections* InIntersectionList, TMap<int32, PCGExGraph::FGraphNodeMetadata*>* InOutMetadata)
+		                             PCGExGraph::FEdgeEdgeIntersections* InIntersectionList, PCGExGraph::FGraphNodeMetadata* InOutMetadata)
 			: FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
 			  IntersectionList(InIntersectionList)
 		{
 		}
 
 		PCGExGraph::FEdgeEdgeIntersections* IntersectionList = nullptr;
-		TMap<int32, PCGExGraph::FGraphNodeMetadata*>* OutMetadata = nullptr;
+		PCGExGraph::FGraphNodeMetadata* OutMetadata = nullptr;
 
 		virtual bool ExecuteTask() override;
 	};
@@ -1209,13 +1294,7 @@ namespace PCGExGraphTask
 
 			if (Point.Seed == 0) { PCGExMath::RandomizeSeed(Point); }
 
-			if (PCGExGraph::FGraphEdgeMetadata** EdgeMetaPtr = Graph->EdgeMetadata.Find(EdgeIndex))
-			{
-				PCGExGraph::FGraphEdgeMetadata* EdgeMeta = *EdgeMetaPtr;
-				//if()
-				//int32 ParentCompoundIndex = PCGExGraph::FGraphEdgeMetadata::GetParentIndex();
-				//TODO: Handle edge metadata	
-			}
+			//TODO: Handle edge metadata, Graph->EdgeMetadata.GetRootIndex(EdgeIndex)
 
 			PointIndex++;
 		}
@@ -1256,10 +1335,7 @@ namespace PCGExGraphTask
 				// Need to go through each point and add flags matching edges
 				for (const int32 NodeIndex : SubGraph->Nodes)
 				{
-					PCGExGraph::FNode Node = Graph->Nodes[NodeIndex];
-					PCGExGraph::FGraphNodeMetadata** NodeMetaPtr = Graph->NodeMetadata.Find(NodeIndex);
-
-					if (!NodeMetaPtr || (*NodeMetaPtr)->Type != EPCGExIntersectionType::EdgeEdge)
+					if (!Graph->NodeMetadata.IsCrossing(NodeIndex))
 					{
 					}
 				}
@@ -1320,21 +1396,6 @@ namespace PCGExGraphTask
 
 #pragma region Compound Graph tasks
 
-	class PCGEXTENDEDTOOLKIT_API FCompoundGraphInsertPoints : public FPCGExNonAbandonableTask
-	{
-	public:
-		FCompoundGraphInsertPoints(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
-		                           PCGExGraph::FCompoundGraph* InGraph)
-			: FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
-			  Graph(InGraph)
-		{
-		}
-
-		PCGExGraph::FCompoundGraph* Graph = nullptr;
-
-		virtual bool ExecuteTask() override;
-	};
-
 	class PCGEXTENDEDTOOLKIT_API FCompoundGraphInsertEdges : public FPCGExNonAbandonableTask
 	{
 	public:
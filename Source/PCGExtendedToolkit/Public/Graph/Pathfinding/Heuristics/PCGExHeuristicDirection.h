@@ -36,9 +36,13 @@ public:
 		const PCGExCluster::FNode& Seed,
 		const PCGExCluster::FNode& Goal) const override;
 
+	virtual bool HasGoalDependentEdgeScore() const override;
+
 protected:
 	double OutMin = 0;
 	double OutMax = 1;
 
+	virtual void ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const override;
+
 	virtual void ApplyOverrides() override;
 };
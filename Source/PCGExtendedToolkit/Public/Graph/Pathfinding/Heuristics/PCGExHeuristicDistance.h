@@ -28,4 +28,6 @@ public:
 
 protected:
 	double MaxDistSquared = 0;
+
+	virtual void ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const override;
 };
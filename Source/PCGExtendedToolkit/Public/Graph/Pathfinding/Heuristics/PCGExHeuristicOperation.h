@@ -38,9 +38,29 @@ public:
 		const PCGExCluster::FNode& Seed,
 		const PCGExCluster::FNode& Goal) const;
 
+	/** Whether GetEdgeScore depends on the goal node, in which case search trees cannot be shared across goals. */
+	virtual bool HasGoalDependentEdgeScore() const;
+
+	/** GetGlobalScore remapped to [0..1] using the cluster-wide bounds computed in PrepareForData. */
+	FORCEINLINE double GetNormalizedGlobalScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal) const
+	{
+		const double Range = MaxGlobalScore - MinGlobalScore;
+		return Range > 0 ? FMath::Clamp((GetGlobalScore(From, Seed, Goal) - MinGlobalScore) / Range, 0, 1) : 0;
+	}
+
 	virtual void Cleanup() override;
 
 protected:
 	PCGExCluster::FCluster* Cluster = nullptr;
 	TObjectPtr<UCurveFloat> ScoreCurveObj;
+
+	double MinGlobalScore = 0;
+	double MaxGlobalScore = 0;
+
+	/** Conservative range of GetGlobalScore for any node and any seed/goal pair within the current cluster. */
+	virtual void ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const;
+	static void GetCurveValueRange(const UCurveFloat* InCurve, double& OutMin, double& OutMax);
 };
@@ -52,5 +52,7 @@ protected:
 
 	double GetDot(const FVector& From, const FVector& To) const;
 
+	virtual void ComputeGlobalScoreBounds(double& OutMin, double& OutMax) const override;
+
 	virtual void ApplyOverrides() override;
 };
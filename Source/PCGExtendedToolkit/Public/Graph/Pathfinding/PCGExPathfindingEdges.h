@@ -53,6 +53,9 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPathfindingEdgesContext : public FPCGExPathf
 
 	int32 CurrentPathBufferIndex = -1;
 	TArray<PCGExPathfinding::FPathQuery*> PathBuffer;
+	TArray<TArray<int32>> SeedQueryGroups; // PathBuffer indices, grouped by seed
+
+	void WritePath(const PCGExPathfinding::FPathQuery* Query, const TArray<int32>& Path) const;
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExPathfindingEdgesElement : public FPCGExPathfindingProcessorElement
@@ -80,3 +83,18 @@ public:
 
 	virtual bool ExecuteTask() override;
 };
+
+/**
+ * Solves all the queries sharing a seed at once, so search algorithms can reuse a single search tree.
+ */
+class PCGEXTENDEDTOOLKIT_API FSampleClusterPathGroupTask : public FPCGExNonAbandonableTask
+{
+public:
+	FSampleClusterPathGroupTask(
+		FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO)
+	{
+	}
+
+	virtual bool ExecuteTask() override;
+};
@@ -1,43 +1,59 @@
-﻿#pragma once
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
 
-#include <queue>
-#include <vector>
+#pragma once
+
+#include "CoreMinimal.h"
 
 namespace PCGExSearch
 {
-	class TScoredQueue
+	/**
+	 * Indexed 4-ary min-heap over node indices.
+	 * Each id is queued at most once; enqueuing an id that is already queued updates its score in place (decrease-key),
+	 * so the queue never grows beyond the number of nodes.
+	 * Equal scores are dequeued in insertion order; an updated entry counts as freshly inserted.
+	 */
+	class PCGEXTENDEDTOOLKIT_API TScoredQueue
 	{
 		struct FScoredNode
 		{
 			int32 Id;
-			double Score = 0;
-
-			/** Creates and initializes a new node. */
-			explicit FScoredNode(const int32& InItem, const double InScore)
-				: Id(InItem), Score(InScore)
-			{
-			}
-
-			/** Creates and initializes a new node. */
-			explicit FScoredNode(int32&& InItem, const double InScore)
-				: Id(MoveTemp(InItem)), Score(InScore)
-			{
-			}
-
-			bool operator<(const FScoredNode& Other) const { return Score < Other.Score; }
-			bool operator>(const FScoredNode& Other) const { return Score > Other.Score; }
+			double Score;
+			uint64 Sequence;
 		};
 
 	protected:
-		std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> InternalQueue;
+		TArray<FScoredNode> Heap;
+		TArray<int32> Positions; // Id -> index in Heap, -1 if not queued
+		uint64 NextSequence = 0;
 
 	public:
 		TArray<double> Scores;
 
+		explicit TScoredQueue(const int32 Size = 0);
 		TScoredQueue(const int32 Size, const int32& Item, const double Score);
 		~TScoredQueue();
 
+		/** Drop any queued entry and make room for Size ids. Only touches entries that were still queued. */
+		void Reset(const int32 Size);
+
 		void Enqueue(const int32& Id, const double Score);
 		bool Dequeue(int32& Item, double& OutScore);
+
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return Heap.Num(); }
+		FORCEINLINE bool IsQueued(const int32 Id) const { return Positions[Id] != -1; }
+
+	protected:
+		FORCEINLINE static bool IsLess(const FScoredNode& A, const FScoredNode& B) { return A.Score < B.Score || (A.Score == B.Score && A.Sequence < B.Sequence); }
+
+		FORCEINLINE void Place(const int32 Index, const FScoredNode& Node)
+		{
+			Heap[Index] = Node;
+			Positions[Node.Id] = Index;
+		}
+
+		void SiftUp(int32 Index);
+		void SiftDown(int32 Index);
 	};
 }
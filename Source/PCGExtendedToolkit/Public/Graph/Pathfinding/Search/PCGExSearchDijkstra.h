@@ -31,4 +31,11 @@ public:
 		const FPCGExHeuristicModifiersSettings* Modifiers,
 		TArray<int32>& OutPath,
 		PCGExPathfinding::FExtraWeights* ExtraWeights) override;
+
+	virtual void FindPaths(
+		const FVector& SeedPosition,
+		const TArray<FVector>& GoalPositions,
+		const UPCGExHeuristicOperation* Heuristics,
+		const FPCGExHeuristicModifiersSettings* Modifiers,
+		TArray<TArray<int32>>& OutPaths) override;
 };
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExOperation.h"
 #include "Graph/PCGExCluster.h"
+#include "PCGExScoredQueue.h"
 #include "UObject/Object.h"
 #include "PCGExSearchOperation.generated.h"
 
@@ -22,6 +23,42 @@ namespace PCGExCluster
 	struct FCluster;
 }
 
+namespace PCGExSearch
+{
+	/**
+	 * Scratch memory reused across queries.
+	 * Per-node entries are only valid when their stamp matches the current generation,
+	 * so starting a new query is O(1) instead of O(NumNodes).
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FSearchWorkspace
+	{
+		TArray<uint32> ScoreStamps;
+		TArray<uint32> VisitedStamps;
+		TArray<double> GScore;
+		TArray<int32> Previous;
+		TScoredQueue OpenQueue;
+		uint32 Generation = 0;
+
+		void Prepare(const int32 NumNodes);
+
+		FORCEINLINE double GetGScore(const int32 NodeIndex) const { return ScoreStamps[NodeIndex] == Generation ? GScore[NodeIndex] : -1; }
+		FORCEINLINE int32 GetPrevious(const int32 NodeIndex) const { return ScoreStamps[NodeIndex] == Generation ? Previous[NodeIndex] : -1; }
+
+		FORCEINLINE void SetGScore(const int32 NodeIndex, const double Score, const int32 PreviousIndex)
+		{
+			ScoreStamps[NodeIndex] = Generation;
+			GScore[NodeIndex] = Score;
+			Previous[NodeIndex] = PreviousIndex;
+		}
+
+		FORCEINLINE bool IsVisited(const int32 NodeIndex) const { return VisitedStamps[NodeIndex] == Generation; }
+		FORCEINLINE void MarkVisited(const int32 NodeIndex) { VisitedStamps[NodeIndex] = Generation; }
+
+		FORCEINLINE void Enqueue(const int32 NodeIndex, const double Score) { OpenQueue.Enqueue(NodeIndex, Score); }
+		FORCEINLINE bool Dequeue(int32& OutNodeIndex, double& OutScore) { return OpenQueue.Dequeue(OutNodeIndex, OutScore); }
+	};
+}
+
 /**
  * 
  */
@@ -45,4 +82,25 @@ public:
 		const FPCGExHeuristicModifiersSettings* Modifiers,
 		TArray<int32>& OutPath,
 		PCGExPathfinding::FExtraWeights* ExtraWeights = nullptr);
+
+	/**
+	 * Find paths from a single seed to many goals. OutPaths is index-aligned with GoalPositions;
+	 * a failed query leaves its path empty. The default implementation runs one FindPath per goal.
+	 */
+	virtual void FindPaths(
+		const FVector& SeedPosition,
+		const TArray<FVector>& GoalPositions,
+		const UPCGExHeuristicOperation* Heuristics,
+		const FPCGExHeuristicModifiersSettings* Modifiers,
+		TArray<TArray<int32>>& OutPaths);
+
+	virtual void Cleanup() override;
+
+protected:
+	/** Borrow a workspace sized for the current cluster. Each concurrent query holds its own. */
+	PCGExSearch::FSearchWorkspace* AcquireWorkspace();
+	void ReleaseWorkspace(PCGExSearch::FSearchWorkspace* InWorkspace);
+
+	mutable FRWLock WorkspaceLock;
+	TArray<PCGExSearch::FSearchWorkspace*> Workspaces;
 };
@@ -121,7 +121,6 @@ namespace FPCGExFilter
 
 		virtual void Cleanup() override
 		{
-			Values.Empty();
 			FLocalSingleFieldGetter::Cleanup();
 		}
 	};
@@ -111,10 +111,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExFusePointsContext : public FPCGExPointsProce
 	FPCGExPointPointIntersectionSettings PointPointIntersectionSettings;
 
 	PCGExGraph::FGraphMetadataSettings GraphMetadataSettings;
-	PCGExGraph::FCompoundGraph* CompoundGraph = nullptr;
 	bool bPreserveOrder;
-
-	mutable FRWLock PointsLock;
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExFusePointsElement : public FPCGExPointsProcessorElementBase
@@ -128,3 +125,23 @@ protected:
 	virtual bool Boot(FPCGContext* InContext) const override;
 	virtual bool ExecuteInternal(FPCGContext* Context) const override;
 };
+
+namespace PCGExFusePoints
+{
+	/** Fuses, re-centers and blends a single input, independently from the others. */
+	class PCGEXTENDEDTOOLKIT_API FProcessor final : public PCGExPointsMT::FPointsProcessor
+	{
+	public:
+		explicit FProcessor(PCGExData::FPointIO* InPoints):
+			FPointsProcessor(InPoints)
+		{
+		}
+
+		virtual ~FProcessor() override;
+
+		PCGExGraph::FCompoundGraph* CompoundGraph = nullptr;
+
+		virtual bool Process(FPCGExAsyncManager* AsyncManager) override;
+		virtual void CompleteWork() override;
+	};
+}
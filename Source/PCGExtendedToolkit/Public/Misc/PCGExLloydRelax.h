@@ -10,6 +10,11 @@
 #include "Geometry/PCGExGeo.h"
 #include "PCGExLloydRelax.generated.h"
 
+namespace PCGExGeo
+{
+	class TDelaunay3;
+}
+
 /**
  * Calculates the distance between two points (inherently a n*n operation)
  */
@@ -51,6 +56,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExLloydRelaxContext : public FPCGExPointsProce
 
 	PCGEx::FLocalSingleFieldGetter* InfluenceGetter = nullptr;
 	TArray<FVector> ActivePositions;
+	PCGExGeo::TDelaunay3* Delaunay = nullptr; // Kept across iterations and repaired rather than rebuilt
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExLloydRelaxElement : public FPCGExPointsProcessorElementBase
@@ -71,11 +77,13 @@ class PCGEXTENDEDTOOLKIT_API FPCGExLloydRelax3Task : public FPCGExNonAbandonable
 public:
 	FPCGExLloydRelax3Task(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
 	                      TArray<FVector>* InPositions,
+	                      PCGExGeo::TDelaunay3* InDelaunay,
 	                      const FPCGExInfluenceSettings* InInfluenceSettings,
 	                      const int32 InNumIterations,
 	                      PCGEx::FLocalSingleFieldGetter* InInfluenceGetter = nullptr) :
 		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
 		ActivePositions(InPositions),
+		Delaunay(InDelaunay),
 		InfluenceSettings(InInfluenceSettings),
 		NumIterations(InNumIterations),
 		InfluenceGetter(InInfluenceGetter)
@@ -83,6 +91,7 @@ public:
 	}
 
 	TArray<FVector>* ActivePositions = nullptr;
+	PCGExGeo::TDelaunay3* Delaunay = nullptr;
 	const FPCGExInfluenceSettings* InfluenceSettings = nullptr;
 	int32 NumIterations = 0;
 	PCGEx::FLocalSingleFieldGetter* InfluenceGetter = nullptr;
@@ -10,6 +10,11 @@
 #include "Geometry/PCGExGeo.h"
 #include "PCGExLloydRelax2D.generated.h"
 
+namespace PCGExGeo
+{
+	class TDelaunay2;
+}
+
 /**
  * Calculates the distance between two points (inherently a n*n operation)
  */
@@ -56,6 +61,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExLloydRelax2DContext : public FPCGExPointsPro
 	FPCGExGeo2DProjectionSettings ProjectionSettings;
 	PCGEx::FLocalSingleFieldGetter* InfluenceGetter = nullptr;
 	TArray<FVector> ActivePositions;
+	PCGExGeo::TDelaunay2* Delaunay = nullptr; // Kept across iterations and repaired rather than rebuilt
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExLloydRelax2DElement : public FPCGExPointsProcessorElementBase
@@ -76,12 +82,14 @@ class PCGEXTENDEDTOOLKIT_API FPCGExLloydRelax2Task : public FPCGExNonAbandonable
 public:
 	FPCGExLloydRelax2Task(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
 	                      TArray<FVector>* InPositions,
+	                      PCGExGeo::TDelaunay2* InDelaunay,
 	                      const FPCGExInfluenceSettings* InInfluenceSettings,
 	                      const int32 InNumIterations,
 	                      PCGEx::FLocalSingleFieldGetter* InInfluenceGetter = nullptr,
 	                      FPCGExGeo2DProjectionSettings* InProjectionSettings = nullptr) :
 		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
 		ActivePositions(InPositions),
+		Delaunay(InDelaunay),
 		InfluenceSettings(InInfluenceSettings),
 		NumIterations(InNumIterations),
 		InfluenceGetter(InInfluenceGetter),
@@ -90,6 +98,7 @@ public:
 	}
 
 	TArray<FVector>* ActivePositions = nullptr;
+	PCGExGeo::TDelaunay2* Delaunay = nullptr;
 	const FPCGExInfluenceSettings* InfluenceSettings = nullptr;
 	int32 NumIterations = 0;
 	PCGEx::FLocalSingleFieldGetter* InfluenceGetter = nullptr;
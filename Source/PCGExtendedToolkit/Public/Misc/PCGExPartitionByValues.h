@@ -18,10 +18,6 @@ namespace PCGExPartition
 
 	class PCGEXTENDEDTOOLKIT_API FKPartition
 	{
-	protected:
-		mutable FRWLock LayersLock;
-		mutable FRWLock PointLock;
-
 	public:
 		FKPartition(FKPartition* InParent, int64 InKey, FPCGExFilter::FRule* InRule, int32 InPartitionIndex);
 		~FKPartition();
@@ -31,19 +27,23 @@ namespace PCGExPartition
 		int64 PartitionKey = 0;
 		FPCGExFilter::FRule* Rule = nullptr;
 
-		TSet<int64> UniquePartitionKeys;
-		TMap<int64, FKPartition*> SubLayers;
-		TArray<int32> Points;
+		TArray<FKPartition*> SubLayers; // In ascending key order
 
-		int32 GetNum() const { return Points.Num(); }
-		int32 GetSubPartitionsNum();
+		int32 Start = 0; // First point of this partition in the partitioned indices
+		int32 Count = 0;
 
-		FKPartition* GetPartition(int64 Key, FPCGExFilter::FRule* InRule);
-		void Add(const int64 Index);
-		void Register(TArray<FKPartition*>& Partitions);
+		int32 GetNum() const { return Count; }
 
-		void SortPartitions();
+		void Register(TArray<FKPartition*>& Partitions);
 	};
+
+	/**
+	 * Splits points under Root, one layer per rule, from each rule's FilteredValues.
+	 * Each layer is a stable parallel radix sort of (parent partition, key rank) pairs, so no partition is ever locked :
+	 * every partition ends up as a contiguous range of OutIndices, its points in input order, and siblings are
+	 * indexed in ascending key order.
+	 */
+	PCGEXTENDEDTOOLKIT_API void BuildPartitions(FKPartition* Root, TArray<FPCGExFilter::FRule>& Rules, const int32 NumPoints, TArray<int32>& OutIndices);
 }
 
 
@@ -84,6 +84,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bSplitOutput = true;
 
+	/** If enabled, partitions are output as lightweight views over the input points instead of copies. Points are only copied once a downstream node reads them as point data, which keeps memory low when partitions are filtered out or only inspected through their metadata. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay, meta=(PCG_Overridable, EditCondition="bSplitOutput"))
+	bool bOutputIndexViews = false;
+
 	/** Rules */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, TitleProperty="{TitlePropertyName}"))
 	TArray<FPCGExFilterRuleDescriptor> PartitionRules;
@@ -105,12 +109,12 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPartitionByValuesContext : public FPCGExPoin
 
 	TArray<FPCGExFilterRuleDescriptor> RulesDescriptors;
 	TArray<FPCGExFilter::FRule> Rules;
-	mutable FRWLock RulesLock;
 
 	TArray<int64> KeySums;
 
 	bool bSplitOutput = true;
 	PCGExPartition::FKPartition* RootPartition = nullptr;
+	TSharedPtr<TArray<int32>> PartitionedIndices; // Shared with index view outputs, which may outlive the context
 
 	int32 NumPartitions = -1;
 	TArray<PCGExPartition::FKPartition*> Partitions;
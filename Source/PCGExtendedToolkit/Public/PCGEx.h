@@ -243,6 +243,100 @@ namespace PCGEx
 		for (int i = 0; i < InNum; i++) { OutArray[i] = i; }
 	}
 
+	/**
+	 * Stable LSD radix sort of 64bit keys, carrying an optional int32 payload along (Values may be null).
+	 * Byte columns that are identical across all keys are skipped, so small key ranges only cost a few passes.
+	 */
+	static void RadixSort(uint64* Keys, int32* Values, const int32 Num)
+	{
+		if (Num <= 1) { return; }
+
+		uint64 AllOr = 0;
+		uint64 AllAnd = ~0ULL;
+		for (int i = 0; i < Num; i++)
+		{
+			AllOr |= Keys[i];
+			AllAnd &= Keys[i];
+		}
+		const uint64 VaryingBits = AllOr ^ AllAnd;
+
+		TArray<uint64> KeysBuffer;
+		TArray<int32> ValuesBuffer;
+		KeysBuffer.SetNumUninitialized(Num);
+		if (Values) { ValuesBuffer.SetNumUninitialized(Num); }
+
+		uint64* SrcKeys = Keys;
+		int32* SrcValues = Values;
+		uint64* DstKeys = KeysBuffer.GetData();
+		int32* DstValues = Values ? ValuesBuffer.GetData() : nullptr;
+
+		int32 Offsets[256];
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
+		{
+			if (((VaryingBits >> Shift) & 0xFF) == 0) { continue; }
+
+			FMemory::Memzero(Offsets, sizeof(Offsets));
+			for (int i = 0; i < Num; i++) { Offsets[(SrcKeys[i] >> Shift) & 0xFF]++; }
+
+			int32 Sum = 0;
+			for (int32& Offset : Offsets)
+			{
+				const int32 Count = Offset;
+				Offset = Sum;
+				Sum += Count;
+			}
+
+			if (Values)
+			{
+				for (int i = 0; i < Num; i++)
+				{
+					const int32 Target = Offsets[(SrcKeys[i] >> Shift) & 0xFF]++;
+					DstKeys[Target] = SrcKeys[i];
+					DstValues[Target] = SrcValues[i];
+				}
+			}
+			else
+			{
+				for (int i = 0; i < Num; i++) { DstKeys[Offsets[(SrcKeys[i] >> Shift) & 0xFF]++] = SrcKeys[i]; }
+			}
+
+			Swap(SrcKeys, DstKeys);
+			Swap(SrcValues, DstValues);
+		}
+
+		if (SrcKeys != Keys)
+		{
+			FMemory::Memcpy(Keys, SrcKeys, Num * sizeof(uint64));
+			if (Values) { FMemory::Memcpy(Values, SrcValues, Num * sizeof(int32)); }
+		}
+	}
+
+	static void RadixSort(TArray<uint64>& Keys, TArray<int32>& Values)
+	{
+		check(Values.Num() == Keys.Num())
+		RadixSort(Keys.GetData(), Values.GetData(), Keys.Num());
+	}
+
+	static void RadixSort(TArray<uint64>& Keys)
+	{
+		RadixSort(Keys.GetData(), nullptr, Keys.Num());
+	}
+
+	/** Radix sorts keys and removes duplicates. */
+	static void SortUnique(TArray<uint64>& Keys)
+	{
+		RadixSort(Keys);
+
+		int32 WriteIndex = 0;
+		for (int i = 0; i < Keys.Num(); i++)
+		{
+			if (WriteIndex > 0 && Keys[WriteIndex - 1] == Keys[i]) { continue; }
+			Keys[WriteIndex++] = Keys[i];
+		}
+
+		Keys.SetNum(WriteIndex);
+	}
+
 	static FName GetCompoundName(const FName A, const FName B)
 	{
 		// PCGEx/A/B
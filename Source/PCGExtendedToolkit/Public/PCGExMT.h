@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "PCGContext.h"
 #include "Data/PCGExPointIO.h"
 #include "Helpers/PCGAsync.h"
@@ -24,6 +26,58 @@ namespace PCGExMT
 	constexpr AsyncState State_WaitingOnAsyncWork = __COUNTER__;
 	constexpr AsyncState State_Done = __COUNTER__;
 
+	constexpr int64 GBatchMemoryBudget = 1024LL * 1024 * 1024; // Upper bound of the estimated memory of IOs batch-processed concurrently
+
+	constexpr double GParallelForChunkBudget = 0.0001; // Target duration of a single chunk, in seconds
+	constexpr int32 GParallelForInitialChunk = 16;
+	constexpr int32 GParallelForMaxChunk = 4096;
+
+	static int32 GetNumPoolWorkers() { return FMath::Max(1, GThreadPool ? GThreadPool->GetNumThreads() : 1); }
+
+	/**
+	 * Shared state of a work-stealing parallel loop.
+	 * The range is split evenly across workers; each one consumes its own slice front to back,
+	 * sizing chunks from the measured cost of the previous ones, and steals the back half
+	 * of another worker's slice once its own is exhausted.
+	 * The loop body is owned by the state.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FParallelForState
+	{
+	public:
+		FParallelForState(const int32 InNumIterations, const int32 InNumWorkers, TFunction<void(int32)>&& InBody);
+
+		int32 GetNumWorkers() const { return NumWorkers; }
+
+		/** Processes iterations until there is nothing left to take or steal. Must be called at most once per worker index. */
+		void RunWorker(const int32 WorkerIndex);
+
+	protected:
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FSlice
+		{
+			std::atomic<uint64> Range{0};
+		};
+
+		TFunction<void(int32)> Body;
+		int32 NumWorkers = 1;
+		TUniquePtr<FSlice[]> Slices;
+
+		static bool TakeFront(FSlice& Slice, const int32 Count, int32& OutBegin, int32& OutEnd);
+		static bool StealBack(FSlice& Slice, int32& OutBegin, int32& OutEnd);
+	};
+
+	/**
+	 * Blocking work-stealing loop over [0, NumIterations).
+	 * The calling thread takes part as the first worker, and returns once every iteration has been processed.
+	 */
+	PCGEXTENDEDTOOLKIT_API void ParallelFor(const int32 NumIterations, const int32 NumWorkers, TFunctionRef<void(int32)> Body);
+
+	/**
+	 * Stable LSD radix sort of Keys, carrying Values along, with each pass split in contiguous chunks :
+	 * chunks build their byte histograms in parallel, then scatter in parallel to disjoint, ordered ranges.
+	 * Falls back to PCGEx::RadixSort on small inputs.
+	 */
+	PCGEXTENDEDTOOLKIT_API void ParallelRadixSort(TArray<uint64>& Keys, TArray<int32>& Values);
+
 	struct PCGEXTENDEDTOOLKIT_API FChunkedLoop
 	{
 		FChunkedLoop()
@@ -92,52 +146,45 @@ namespace PCGExMT
 		template <class InitializeFunc, class LoopBodyFunc>
 		bool Advance(InitializeFunc&& Initialize, LoopBodyFunc&& LoopBody)
 		{
-			if (bAsyncEnabled)
-			{
-				return FPCGAsync::AsyncProcessingOneToOneEx(
-					&(Context->AsyncState), NumIterations, Initialize, [&](int32 ReadIndex, int32 WriteIndex)
-					{
-						LoopBody(ReadIndex);
-						return true;
-					}, true, ChunkSize);
-			}
-
-			if (CurrentIndex == -1) { CurrentIndex = 0; }
-			const int32 ChunkNumIterations = FMath::Min(NumIterations - CurrentIndex, GetCurrentChunkSize());
-			if (ChunkNumIterations <= 0)
-			{
-				CurrentIndex = -1;
-				return true;
-			}
-			for (int i = 0; i < ChunkNumIterations; i++) { LoopBody(CurrentIndex + i); }
-			CurrentIndex += ChunkNumIterations;
-			return false;
+			if (CurrentIndex == -1) { Initialize(); }
+			return Advance(LoopBody);
 		}
 
+		/**
+		 * Processes the next part of the loop, and returns true once every iteration has been processed.
+		 * When async is enabled, iterations are run in parallel slices until the context's time budget for this tick runs out.
+		 */
 		template <class LoopBodyFunc>
 		bool Advance(LoopBodyFunc&& LoopBody)
 		{
+			if (CurrentIndex == -1) { CurrentIndex = 0; }
+
 			if (bAsyncEnabled)
 			{
-				return FPCGAsync::AsyncProcessingOneToOneEx(
-					&(Context->AsyncState), NumIterations, []()
-					{
-					}, [&](int32 ReadIndex, int32 WriteIndex)
-					{
-						LoopBody(ReadIndex);
-						return true;
-					}, true, ChunkSize);
+				const int32 NumWorkers = GetNumWorkers();
+				const int32 SliceSize = FMath::Max(1, ChunkSize) * NumWorkers * 4;
+
+				while (CurrentIndex < NumIterations)
+				{
+					const int32 SliceStart = CurrentIndex;
+					const int32 SliceNumIterations = FMath::Min(SliceSize, NumIterations - SliceStart);
+					ParallelFor(SliceNumIterations, NumWorkers, [&](const int32 i) { LoopBody(SliceStart + i); });
+					CurrentIndex += SliceNumIterations;
+					if (Context && Context->AsyncState.ShouldStop()) { break; }
+				}
+			}
+			else
+			{
+				const int32 ChunkNumIterations = FMath::Min(NumIterations - CurrentIndex, GetCurrentChunkSize());
+				for (int i = 0; i < ChunkNumIterations; i++) { LoopBody(CurrentIndex + i); }
+				CurrentIndex += FMath::Max(0, ChunkNumIterations);
 			}
 
-			if (CurrentIndex == -1) { CurrentIndex = 0; }
-			const int32 ChunkNumIterations = FMath::Min(NumIterations - CurrentIndex, GetCurrentChunkSize());
-			if (ChunkNumIterations <= 0)
+			if (CurrentIndex >= NumIterations)
 			{
 				CurrentIndex = -1;
 				return true;
 			}
-			for (int i = 0; i < ChunkNumIterations; i++) { LoopBody(CurrentIndex + i); }
-			CurrentIndex += ChunkNumIterations;
 			return false;
 		}
 
@@ -146,6 +193,11 @@ namespace PCGExMT
 		{
 			return FMath::Min(ChunkSize, NumIterations - CurrentIndex);
 		}
+
+		int32 GetNumWorkers() const
+		{
+			return FMath::Max(1, Context ? Context->AsyncState.NumAvailableTasks : 1);
+		}
 	};
 
 	/**
@@ -183,6 +235,18 @@ namespace PCGExMT
 		return FPCGAsync::AsyncProcessingOneToOneEx(&(Context->AsyncState), NumIterations, Initialize, InnerBodyLoop, true, ChunkSize);
 	}
 
+	/**
+	 * Size of the ranges a loop of NumIterations should be split into when dispatched as range tasks.
+	 * Ranges are never smaller than ChunkSize, and there are never much more of them than there are workers to process them.
+	 * @param NumIterations 
+	 * @param ChunkSize Minimum range size
+	 * @return 
+	 */
+	static int32 GetRangeSize(const int32 NumIterations, const int32 ChunkSize)
+	{
+		return FMath::Max3(1, ChunkSize, FMath::DivideAndRoundUp(NumIterations, GetNumPoolWorkers() * 4));
+	}
+
 	static bool ParallelForLoop
 		(
 		FPCGContext* Context,
@@ -211,6 +275,9 @@ namespace PCGExMT
 
 class FPCGExNonAbandonableTask;
 
+template <typename T>
+class FPCGExRangeTask;
+
 class PCGEXTENDEDTOOLKIT_API FPCGExAsyncManager
 {
 	friend class FPCGExNonAbandonableTask;
@@ -218,25 +285,31 @@ class PCGEXTENDEDTOOLKIT_API FPCGExAsyncManager
 public:
 	~FPCGExAsyncManager();
 
-	mutable FRWLock ManagerLock;
 	FPCGContext* Context;
-	bool bStopped = false;
+	std::atomic<bool> bStopped{false};
 	bool bForceSync = false;
 
 	template <typename T>
 	void Start(FAsyncTask<T>* AsyncTask)
 	{
+		// Announce the start before checking flags, so Reset either sees us in flight or we see it flushing
+		NumStarting.fetch_add(1);
+
+		if (bStopped || bFlushing)
 		{
-			FWriteScopeLock WriteLock(ManagerLock);
-			if (bStopped) { return; }
-			NumStarted++;
-			QueuedTasks.Add(AsyncTask);
+			NumStarting.fetch_sub(1);
+			delete AsyncTask;
+			return;
 		}
 
 		T& Task = AsyncTask->GetTask();
 		Task.TaskPtr = AsyncTask;
 
+		NumStarted.fetch_add(1);
+		Track(&Task); // Tracked before it can run, so Reset always has a handle on it
 		AsyncTask->StartBackgroundTask();
+
+		NumStarting.fetch_sub(1);
 	}
 
 	template <typename T, typename... Args>
@@ -247,19 +320,50 @@ public:
 		else { Start<T>(new FAsyncTask<T>(this, TaskIndex, InPointsIO, args...)); }
 	}
 
+	/**
+	 * Start tasks of type T over [0, NumIterations), grouped in ranges.
+	 * Each range is a single async task that runs T's body for every index it owns,
+	 * so the number of tasks scales with workers & chunk size rather than with NumIterations.
+	 * T must be constructible from (Manager, TaskIndex, PointIO).
+	 */
+	template <typename T>
+	void StartRanges(const int32 NumIterations, const int32 ChunkSize, PCGExData::FPointIO* InPointsIO)
+	{
+		if (bStopped || NumIterations <= 0) { return; }
+
+		const int32 RangeSize = PCGExMT::GetRangeSize(NumIterations, ChunkSize);
+		int32 StartIndex = 0;
+
+		while (StartIndex < NumIterations)
+		{
+			const int32 RangeNumIterations = FMath::Min(RangeSize, NumIterations - StartIndex);
+			Start<FPCGExRangeTask<T>>(StartIndex, InPointsIO, RangeNumIterations);
+			StartIndex += RangeNumIterations;
+		}
+	}
+
+	/**
+	 * Start a non-blocking work-stealing loop, processed by one task per worker.
+	 * The body is owned by the loop, but anything it captures by reference must outlive the async work.
+	 */
+	void StartParallelFor(const int32 NumIterations, TFunction<void(int32)>&& Body, const int32 NumWorkers = -1);
+
 	template <typename T>
 	void StartSync(FAsyncTask<T>* AsyncTask)
 	{
+		if (bStopped)
 		{
-			FWriteScopeLock WriteLock(ManagerLock);
-			if (bStopped) { return; }
-			NumStarted++;
+			delete AsyncTask;
+			return;
 		}
 
 		T& Task = AsyncTask->GetTask();
 		Task.TaskPtr = AsyncTask;
 
+		NumStarted.fetch_add(1);
 		AsyncTask->StartSynchronousTask();
+
+		delete AsyncTask;
 	}
 
 	template <typename T, typename... Args>
@@ -269,8 +373,6 @@ public:
 		StartSync(new FAsyncTask<T>(this, Index, InPointsIO, args...));
 	}
 
-	void Reserve(const int32 NumTasks) { QueuedTasks.Reserve(NumTasks); }
-
 	void OnAsyncTaskExecutionComplete(FPCGExNonAbandonableTask* AsyncTask, bool bSuccess);
 	bool IsAsyncWorkComplete() const;
 
@@ -280,10 +382,15 @@ public:
 	T* GetContext() { return static_cast<T*>(Context); }
 
 protected:
-	bool bFlushing = false;
-	int32 NumStarted = 0;
-	int32 NumCompleted = 0;
-	TSet<FAsyncTaskBase*> QueuedTasks;
+	std::atomic<bool> bFlushing{false};
+	std::atomic<int32> NumStarting{0};
+	std::atomic<int32> NumStarted{0};
+	std::atomic<int32> NumCompleted{0};
+
+	/** Head of the intrusive list of started tasks, linked through FPCGExNonAbandonableTask::NextTracked */
+	std::atomic<FPCGExNonAbandonableTask*> TrackedTasks{nullptr};
+
+	void Track(FPCGExNonAbandonableTask* InTask);
 };
 
 class PCGEXTENDEDTOOLKIT_API FPCGExNonAbandonableTask : public FNonAbandonableTask
@@ -292,6 +399,7 @@ public:
 	FPCGExAsyncManager* Manager = nullptr;
 	int32 TaskIndex = -1;
 	FAsyncTaskBase* TaskPtr = nullptr;
+	FPCGExNonAbandonableTask* NextTracked = nullptr;
 	PCGExData::FPointIO* PointIO = nullptr;
 
 #define PCGEX_ASYNC_CHECKPOINT_VOID  if (!Checkpoint()) { return; }
@@ -323,69 +431,49 @@ protected:
 	bool Checkpoint() const { return !(!Manager || Manager->bStopped || Manager->bFlushing); }
 };
 
-
-template <class TBodyFunc>
-class PCGEXTENDEDTOOLKIT_API FPCGExLoopChunkTask : public FPCGExNonAbandonableTask
+template <typename T>
+class PCGEXTENDEDTOOLKIT_API FPCGExRangeTask : public FPCGExNonAbandonableTask
 {
 public:
-	FPCGExLoopChunkTask(
+	FPCGExRangeTask(
 		FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
-		TBodyFunc&& InBodyFunc,
 		const int32 InNumIterations) :
 		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
-		BodyFunc(InBodyFunc),
 		NumIterations(InNumIterations)
 	{
 	}
 
-	TBodyFunc&& BodyFunc;
 	int32 NumIterations = 0;
 
 	virtual bool ExecuteTask() override
 	{
-		for (int i = 0; i < NumIterations; i++) { BodyFunc(TaskIndex + i); }
+		const int32 EndIndex = TaskIndex + NumIterations;
+		for (int i = TaskIndex; i < EndIndex; i++)
+		{
+			PCGEX_ASYNC_CHECKPOINT
+			T Task(Manager, i, PointIO);
+			Task.ExecuteTask();
+		}
 		return true;
 	}
 };
 
-template <class TInitFunc, class TBodyFunc>
-class PCGEXTENDEDTOOLKIT_API FPCGExParallelLoopTask : public FPCGExNonAbandonableTask
+class PCGEXTENDEDTOOLKIT_API FPCGExParallelForTask : public FPCGExNonAbandonableTask
 {
 public:
-	FPCGExParallelLoopTask(
+	FPCGExParallelForTask(
 		FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
-		TInitFunc&& InInitFunc,
-		TBodyFunc&& InBodyFunc,
-		const int32 InNumIterations,
-		const int32 InChunkSize) :
+		const TSharedPtr<PCGExMT::FParallelForState>& InState) :
 		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
-		InitFunc(InInitFunc),
-		BodyFunc(InBodyFunc),
-		NumIterations(InNumIterations),
-		ChunkSize(InChunkSize)
+		State(InState)
 	{
 	}
 
-	TInitFunc&& InitFunc;
-	TBodyFunc&& BodyFunc;
-	int32 NumIterations = 0;
-	int32 ChunkSize = 0;
+	TSharedPtr<PCGExMT::FParallelForState> State;
 
 	virtual bool ExecuteTask() override
 	{
-		InitFunc();
-
-		const int32 LoopCount = FMath::Max(NumIterations / ChunkSize, 1);
-		int32 StartIndex = 0;
-
-		for (int i = 0; i < LoopCount; i++)
-		{
-			const int32 LoopNumIterations = FMath::Min(NumIterations, FMath::Min(ChunkSize, NumIterations - (ChunkSize * i)));
-			if (LoopNumIterations == 0) { break; }
-			Manager->Start<FPCGExLoopChunkTask<TBodyFunc>>(StartIndex, nullptr, BodyFunc, LoopNumIterations);
-			StartIndex += ChunkSize;
-		}
-
+		State->RunWorker(TaskIndex);
 		return true;
 	}
 };
@@ -334,11 +334,11 @@ namespace PCGExMath
 	}
 
 	template <typename T>
-	static T GetMedian(const TArray<T>& Values)
+	static T GetMedian(const TArrayView<const T>& Values)
 	{
 		TArray<T> SortedValues;
 		SortedValues.Reserve(Values.Num());
-		SortedValues.Append(Values);
+		SortedValues.Append(Values.GetData(), Values.Num());
 		SortedValues.Sort();
 
 		T Median = T{};
@@ -356,7 +356,10 @@ namespace PCGExMath
 		return Median;
 	}
 
-	static double GetMode(const TArray<double>& Values, const bool bHighest, const uint32 Tolerance = 5)
+	template <typename T>
+	static T GetMedian(const TArray<T>& Values) { return GetMedian(TArrayView<const T>(Values)); }
+
+	static double GetMode(const TArrayView<const double>& Values, const bool bHighest, const uint32 Tolerance = 5)
 	{
 		TMap<double, int32> Map;
 		int32 LastCount = 0;
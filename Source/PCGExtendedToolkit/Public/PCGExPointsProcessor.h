@@ -58,6 +58,34 @@ FPCGElementPtr UPCGEx##_NAME##Settings::CreateElement() const{	return MakeShared
 
 struct FPCGExPointsProcessorContext;
 
+namespace PCGExPointsMT
+{
+	/**
+	 * Self-contained processing of a single FPointIO, used by batch processing.
+	 * Process runs on a worker and must only touch its own IO and read-only context data.
+	 * CompleteWork runs on the main thread, in input order, once every processor of the batch is done.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPointsProcessor
+	{
+	public:
+		PCGExData::FPointIO* PointIO = nullptr;
+		int32 BatchIndex = -1;
+
+		explicit FPointsProcessor(PCGExData::FPointIO* InPoints):
+			PointIO(InPoints)
+		{
+		}
+
+		virtual ~FPointsProcessor() = default;
+
+		/** Rough memory footprint of this processor while it runs, used to cap how many IOs are processed at once. */
+		virtual int64 GetEstimatedMemory() const;
+
+		virtual bool Process(FPCGExAsyncManager* AsyncManager) = 0;
+		virtual void CompleteWork();
+	};
+}
+
 namespace PCGEx
 {
 	struct PCGEXTENDEDTOOLKIT_API FAPointLoop
@@ -264,9 +292,40 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExPointsProcessorContext : public FPCGContext
 	template <class InitializeFunc, class LoopBodyFunc>
 	void ParallelProcess(InitializeFunc&& Initialize, LoopBodyFunc&& LoopBody, const int32 NumIterations)
 	{
-		GetAsyncManager()->Start<FPCGExParallelLoopTask>(-1, nullptr, Initialize, LoopBody, NumIterations, ChunkSize);
+		Initialize();
+		GetAsyncManager()->StartParallelFor(NumIterations, Forward<LoopBodyFunc>(LoopBody));
 	}
 
+	/**
+	 * Create one processor per main IO that passes ValidateEntry, and start processing them concurrently,
+	 * within the given memory budget. Use ProcessPointsBatch to advance & complete the batch.
+	 */
+	template <typename T>
+	void StartBatchProcessingPoints(TFunction<bool(PCGExData::FPointIO&)>&& ValidateEntry, const int64 MemoryBudget = PCGExMT::GBatchMemoryBudget)
+	{
+		PCGEX_DELETE_TARRAY(BatchProcessors)
+
+		for (PCGExData::FPointIO* PointIO : MainPoints->Pairs)
+		{
+			if (!ValidateEntry(*PointIO)) { continue; }
+			T* Processor = new T(PointIO);
+			Processor->BatchIndex = BatchProcessors.Add(Processor);
+		}
+
+		BatchCursor = 0;
+		BatchMemoryInFlight = 0;
+		BatchMemoryBudget = MemoryBudget;
+
+		StartBatchProcessors();
+	}
+
+	/**
+	 * @return true once every processor is done and had its work completed, in input order.
+	 */
+	bool ProcessPointsBatch();
+
+	void OnBatchProcessorComplete(const PCGExPointsMT::FPointsProcessor* Processor);
+
 	void Output(FPCGTaggedData& OutTaggedData, UPCGData* OutData, const FName OutputLabel);
 	FPCGTaggedData* Output(UPCGData* OutData, const FName OutputLabel);
 	void Output(PCGExData::FPointIO& PointIO);
@@ -315,6 +374,14 @@ protected:
 	TArray<UPCGExOperation*> ProcessorOperations;
 	TSet<UPCGExOperation*> OwnedProcessorOperations;
 
+	mutable FRWLock BatchLock;
+	TArray<PCGExPointsMT::FPointsProcessor*> BatchProcessors;
+	int32 BatchCursor = 0;
+	int64 BatchMemoryInFlight = 0;
+	int64 BatchMemoryBudget = PCGExMT::GBatchMemoryBudget;
+
+	void StartBatchProcessors();
+
 	void CleanupOperations();
 	virtual void ResetAsyncWork();
 
@@ -343,3 +410,18 @@ protected:
 	virtual FPCGContext* InitializeContext(FPCGExPointsProcessorContext* InContext, const FPCGDataCollection& InputData, TWeakObjectPtr<UPCGComponent> SourceComponent, const UPCGNode* Node) const;
 	virtual bool Boot(FPCGContext* InContext) const;
 };
+
+class PCGEXTENDEDTOOLKIT_API FPCGExProcessPointsTask : public FPCGExNonAbandonableTask
+{
+public:
+	FPCGExProcessPointsTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO,
+	                        PCGExPointsMT::FPointsProcessor* InProcessor) :
+		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO),
+		Processor(InProcessor)
+	{
+	}
+
+	PCGExPointsMT::FPointsProcessor* Processor = nullptr;
+
+	virtual bool ExecuteTask() override;
+};
@@ -194,13 +194,20 @@ protected:
 	virtual bool ExecuteInternal(FPCGContext* Context) const override;
 };
 
-class PCGEXTENDEDTOOLKIT_API FPCGExWritePathExtrasTask : public FPCGExNonAbandonableTask
+namespace PCGExWritePathExtras
 {
-public:
-	FPCGExWritePathExtrasTask(FPCGExAsyncManager* InManager, const int32 InTaskIndex, PCGExData::FPointIO* InPointIO) :
-		FPCGExNonAbandonableTask(InManager, InTaskIndex, InPointIO)
+	class PCGEXTENDEDTOOLKIT_API FProcessor final : public PCGExPointsMT::FPointsProcessor
 	{
-	}
+	public:
+		explicit FProcessor(PCGExData::FPointIO* InPoints):
+			FPointsProcessor(InPoints)
+		{
+		}
 
-	virtual bool ExecuteTask() override;
-};
+		virtual ~FProcessor() override;
+
+		PCGEX_FOREACH_FIELD_PATHEXTRAS(PCGEX_OUTPUT_DECL)
+
+		virtual bool Process(FPCGExAsyncManager* AsyncManager) override;
+	};
+}
@@ -27,6 +27,11 @@ PCGEX_DELETE(Context->_NAME##Writer)}
 #define PCGEX_OUTPUT_ACCESSOR_INIT(_NAME, _TYPE) if(Context->_NAME##Writer){Context->_NAME##Writer->BindAndGet(PointIO);}
 #define PCGEX_OUTPUT_DELETE(_NAME, _TYPE) PCGEX_DELETE(_NAME##Writer)
 
+// Per-processor writers, mirroring the context ones (used as templates) and bound to the processor's own PointIO
+#define PCGEX_OUTPUT_LOCAL_INIT(_NAME, _TYPE) if(Context->_NAME##Writer){_NAME##Writer = new PCGEx::TFAttributeWriter<_TYPE>(Context->_NAME##Writer->Name); _NAME##Writer->BindAndGet(*PointIO);}
+#define PCGEX_OUTPUT_LOCAL_VALUE(_NAME, _INDEX, _VALUE) if(_NAME##Writer){(*_NAME##Writer)[_INDEX] = _VALUE; }
+#define PCGEX_OUTPUT_LOCAL_WRITE(_NAME, _TYPE) if(_NAME##Writer){_NAME##Writer->Write();}
+
 UENUM(BlueprintType)
 enum class EPCGExSampleMethod : uint8
 {